@@ -6,15 +6,31 @@
 #define IOC_CONTAINER_H
 
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <memory>
-#include <map>
+#include <unordered_map>
+#include <vector>
+#include <tuple>
+#include <array>
+#include <utility>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <bit>
 #include <functional>
+#include <future>
 #include <stdexcept>
 #include <sstream>
-#include <typeindex>
-#include <set>
-#include <boost/functional/hash.hpp>
 #include <boost/type_index.hpp>
 #include "warnings.h"
 
@@ -40,14 +56,303 @@ namespace mabiphmo::ioc_container{
 	};
 	template<unsigned N> FixedString(char const (&)[N]) -> FixedString<N - 1>;
 //endregion
+//region TypeKey
+	/// \brief Identity of a type list (e.g. a type together with an argument signature), computed at compile time
+	/// \details <b>id</b> is the address of a tag that exists once per instantiation, <b>hash</b> is derived from the compiler's signature string.
+	/// Building, hashing and comparing keys therefore neither needs RTTI nor allocates.
+	struct TypeKey {
+		const void *id;
+		std::size_t hash;
+
+		constexpr bool operator==(const TypeKey &other) const noexcept { return id == other.id; }
+	};
+
+	template <typename... Ts>
+	struct TypeTag {
+		static constexpr char tag{};
+
+		/// FNV-1a hash of the (per instantiation unique) function signature
+		static constexpr std::size_t Hash() {
+#if defined(_MSC_VER)
+			constexpr std::string_view signature = __FUNCSIG__;
+#else
+			constexpr std::string_view signature = __PRETTY_FUNCTION__;
+#endif
+			std::uint64_t hash = 14695981039346656037ull;
+			for (char c : signature) {
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 1099511628211ull;
+			}
+			return static_cast<std::size_t>(hash);
+		}
+	};
+
+	/// Key of the type list Ts
+	template <typename... Ts>
+	inline constexpr TypeKey type_key{&TypeTag<Ts...>::tag, TypeTag<Ts...>::Hash()};
+//endregion
+//region RuntimeId
+	/// \brief Interned id of an interface link
+	/// \details Interning an id looks it up in a process wide table (and copies it the first time); afterwards the id is a pointer to the interned string
+	/// and its hash. Link tables hash a RuntimeId by its stored hash and compare it by that pointer, so resolving with a RuntimeId neither hashes nor allocates.
+	/// Interned ids are never released, so a RuntimeId stays valid for the whole process and is as cheap to copy as a pointer.
+	class RuntimeId {
+		/// Interned id and its hash
+		const std::pair<const std::string, std::size_t> *value_;
+
+		static const std::pair<const std::string, std::size_t> *Intern(std::string_view id)
+		{
+			static std::mutex mutex;
+			//deliberately leaked, so ids stay valid while static objects are destroyed
+			static auto &ids = *new std::unordered_map<std::string, std::size_t>();
+			std::lock_guard lock(mutex);
+			return &*ids.try_emplace(std::string(id), std::hash<std::string_view>{}(id)).first;
+		}
+	public:
+		/// The empty id, which links registered without an id have
+		RuntimeId() noexcept
+		{
+			static const auto empty = Intern("");
+			value_ = empty;
+		}
+		explicit RuntimeId(std::string_view id) : value_(Intern(id)) {}
+
+		[[nodiscard]] std::string_view View() const noexcept {return value_->first;}
+		[[nodiscard]] std::size_t Hash() const noexcept {return value_->second;}
+		bool operator==(const RuntimeId &other) const noexcept {return value_ == other.value_;}
+
+		/// Hash of the link tables; ids can be looked up as RuntimeId and as anything convertible to std::string_view
+		struct hash {
+			using is_transparent = void;
+			std::size_t operator()(const RuntimeId &id) const noexcept {return id.Hash();}
+			std::size_t operator()(std::string_view id) const noexcept {return std::hash<std::string_view>{}(id);}
+		};
+		struct equal {
+			using is_transparent = void;
+			bool operator()(const RuntimeId &lhs, const RuntimeId &rhs) const noexcept {return lhs == rhs;}
+			bool operator()(const RuntimeId &lhs, std::string_view rhs) const noexcept {return lhs.View() == rhs;}
+			bool operator()(std::string_view lhs, const RuntimeId &rhs) const noexcept {return lhs == rhs.View();}
+		};
+	};
+//endregion
+//region FlatMap
+	/// \brief Open-addressed hash map from TypeKey to TValue that can be read while it is written to
+	/// \details Slots are probed linearly in a power-of-two sized, contiguous array; since keys carry their hash, a lookup is a mask and usually a single probe.
+	/// Values are allocated once on insertion and never move or get erased. Find is lock-free and may run concurrently with TryEmplace,
+	/// calls to TryEmplace have to be serialized by the caller. Slot arrays that have been replaced by a larger one are kept until the map is destroyed,
+	/// since concurrent readers might still probe them.
+	template <typename TValue>
+	class FlatMap {
+		struct Node {
+			template <typename... TArgs>
+			explicit Node(const TypeKey &key_, TArgs &&... args) : key(key_), value(std::forward<TArgs>(args) ...) {}
+
+			const TypeKey key;
+			TValue value;
+		};
+		struct Table {
+			explicit Table(std::size_t size) : mask(size - 1), slots(std::make_unique<std::atomic<Node *>[]>(size)) {}
+
+			const std::size_t mask;
+			std::unique_ptr<std::atomic<Node *>[]> slots;
+		};
+		std::atomic<const Table *> table_{nullptr};
+		std::vector<std::unique_ptr<Table>> tables_;
+		std::vector<std::unique_ptr<Node>> nodes_;
+
+		static void Insert(const Table &table, Node *node) noexcept {
+			for (auto i = node->key.hash & table.mask;; i = (i + 1) & table.mask) {
+				if (table.slots[i].load(std::memory_order_relaxed) == nullptr) {
+					table.slots[i].store(node, std::memory_order_release);
+					return;
+				}
+			}
+		}
+
+		void Grow() {
+			auto table = std::make_unique<Table>(tables_.empty() ? 16 : (tables_.back()->mask + 1) * 2);
+			for (const auto &node : nodes_)
+				Insert(*table, node.get());
+			table_.store(table.get(), std::memory_order_release);
+			tables_.push_back(std::move(table));
+		}
+	public:
+		FlatMap() = default;
+		FlatMap(const FlatMap &) = delete;
+		FlatMap &operator=(const FlatMap &) = delete;
+
+		/// Looks up the value stored for key
+		/// \return The value or nullptr if there is none
+		TValue *Find(const TypeKey &key) const noexcept {
+			auto table = table_.load(std::memory_order_acquire);
+			if (!table)
+				return nullptr;
+			for (auto i = key.hash & table->mask;; i = (i + 1) & table->mask) {
+				auto node = table->slots[i].load(std::memory_order_acquire);
+				if (node == nullptr)
+					return nullptr;
+				if (node->key.id == key.id)
+					return &node->value;
+			}
+		}
+
+		/// Inserts a value constructed from args if key is not present yet
+		/// \return The value stored for key and whether it was inserted
+		template <typename... TArgs>
+		std::pair<TValue &, bool> TryEmplace(const TypeKey &key, TArgs &&... args) {
+			if (auto value = Find(key))
+				return {*value, false};
+			//keep the load factor at or below 1/2
+			if (tables_.empty() || (nodes_.size() + 1) * 2 > tables_.back()->mask + 1)
+				Grow();
+			auto &node = nodes_.emplace_back(std::make_unique<Node>(key, std::forward<TArgs>(args) ...));
+			Insert(*tables_.back(), node.get());
+			return {node->value, true};
+		}
+
+		/// Calls fn with every stored value; only safe while writers are serialized with the caller
+		template <typename F>
+		void ForEach(F &&fn) const {
+			for (const auto &node : nodes_)
+				fn(node->value);
+		}
+
+		/// Number of stored values; only meaningful while writers are serialized with the caller
+		[[nodiscard]] std::size_t Size() const noexcept { return nodes_.size(); }
+	};
+//endregion
+//region Invoker
+	template <typename TSignature>
+	class Invoker;
+
+	/// \brief Move-only, type-erased callable that stores small callables inline
+	/// \details Calling it is a single indirect call into a function that has the callable inlined. Callables that are larger than the inline buffer
+	/// or whose move constructor might throw are put on the heap instead.
+	template <typename R, typename ... TArgs>
+	class Invoker<R(TArgs...)> {
+	public:
+		/// Size of the inline buffer
+		static constexpr std::size_t capacity = 12 * sizeof(void *);
+	private:
+		enum class Operation{ Move, Destroy };
+		using invoke_t = R (*)(void *, TArgs ...);
+		using manage_t = void (*)(Operation, void *, void *) noexcept;
+
+		template <typename F>
+		static constexpr bool is_inline = sizeof(F) <= capacity && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+
+		alignas(std::max_align_t) std::byte storage_[capacity];
+		invoke_t invoke_ = nullptr;
+		manage_t manage_ = nullptr;
+
+		template <typename F>
+		static F *Target(void *storage) noexcept
+		{
+			if constexpr (is_inline<F>)
+				return std::launder(static_cast<F *>(storage));
+			else
+				return *static_cast<F **>(storage);
+		}
+
+		template <typename F>
+		static R Invoke(void *storage, TArgs ... args)
+		{
+			return (*Target<F>(storage))(std::forward<TArgs>(args) ...);
+		}
+
+		template <typename F>
+		static void Manage(Operation operation, void *storage, void *other) noexcept
+		{
+			switch (operation){
+				case Operation::Move:
+					if constexpr (is_inline<F>){
+						::new(storage) F(std::move(*Target<F>(other)));
+						Target<F>(other)->~F();
+					}
+					else
+						::new(storage) F *(Target<F>(other));
+					break;
+				case Operation::Destroy:
+					if constexpr (is_inline<F>)
+						Target<F>(storage)->~F();
+					else
+						delete Target<F>(storage);
+					break;
+			}
+		}
+	public:
+		Invoker() noexcept = default;
+
+		/// Stores f
+		template <typename F> requires (!std::is_same_v<std::remove_cvref_t<F>, Invoker> && std::is_invocable_r_v<R, std::decay_t<F> &, TArgs ...>)
+		Invoker(F &&f) : invoke_(&Invoke<std::decay_t<F>>), manage_(&Manage<std::decay_t<F>>) // NOLINT(google-explicit-constructor)
+		{
+			if constexpr (is_inline<std::decay_t<F>>)
+				::new(storage_) std::decay_t<F>(std::forward<F>(f));
+			else
+				::new(storage_) std::decay_t<F> *(new std::decay_t<F>(std::forward<F>(f)));
+		}
+
+		Invoker(Invoker &&other) noexcept : invoke_(other.invoke_), manage_(other.manage_)
+		{
+			if (manage_)
+				manage_(Operation::Move, storage_, other.storage_);
+			other.invoke_ = nullptr;
+			other.manage_ = nullptr;
+		}
+
+		Invoker &operator=(Invoker &&other) noexcept
+		{
+			if (this != &other){
+				this->~Invoker();
+				::new(this) Invoker(std::move(other));
+			}
+			return *this;
+		}
+
+		Invoker(const Invoker &) = delete;
+		Invoker &operator=(const Invoker &) = delete;
+
+		~Invoker()
+		{
+			if (manage_)
+				manage_(Operation::Destroy, storage_, nullptr);
+		}
+
+		/// Whether a callable is stored
+		explicit operator bool() const noexcept { return invoke_; }
+
+		/// Calls the stored callable; like std::function this does not require the callable to be const
+		R operator()(TArgs ... args) const
+		{
+			return invoke_(const_cast<std::byte *>(storage_), std::forward<TArgs>(args) ...);
+		}
+	};
+//endregion
+	template <typename... TBindings>
+	class StaticContainer;
 //region Container
     /// \brief IoC Container that stores Singleton- Instances and Factories for both Singletons and non- Singletons
     /// \details When factories are registered, dependencies will be resolved by using the arguments of the factory.
     /// All dependencies that should be resolved have to be of type std::shared_ptr<Dependency> and have to come before all other arguments to the factory.
     /// Also all dependencies cannot have any args or have to be a already-resolved singleton, otherwise the container itself should be used as a "dependency" and resolving should be done "manually".
+    ///
+    /// Lazy and Provider dependencies defer resolving until they are used, which keeps rarely used dependencies from being constructed up front.
+    /// Scoped types are resolved through a ResolutionScope, which keeps one instance per scope.
+    /// If IOC_CONTAINER_METRICS is defined, resolve counts, factory timings and nesting depths are recorded per type (see GetMetrics); otherwise this costs nothing.
+    /// Factories taking an Allocator allocate from the memory resource set for their type, the current ResolutionScope or the whole container (see SetMemoryResource).
+    /// A child container (see CreateChild) inherits everything registered in its parent and can override types locally without affecting the parent.
+    ///
+    /// <b>Thread safety:</b> Registering and resolving may happen from any number of threads at the same time. Registrations are serialized by a mutex
+    /// and become visible atomically, resolving never locks: it only reads immutable data that is published through atomic pointers.
+    /// The intended use is to register everything during startup and only resolve afterwards, which makes every resolve a lock-free read.
+    /// A Singleton's factory runs exactly once, even if it is resolved concurrently for the first time: the first resolver constructs the instance
+    /// while the others wait for it (only resolves of that very Singleton wait), afterwards resolving it is a single atomic load.
 	class Container : public std::enable_shared_from_this<Container>
 	{
 //region Structs
+	private:
+		struct Binding;
 //region public
 	public:
 		template <class T, FixedString id = "">
@@ -55,20 +360,50 @@ namespace mabiphmo::ioc_container{
 			explicit Injection(std::shared_ptr<Container> container) : value(container->ResolveInterface<T, id>()) {}
 			std::shared_ptr<T> value;
 			operator const std::shared_ptr<T> &() {return value;} // NOLINT(google-explicit-constructor)
+		private:
+			friend class Container;
+			template <typename...> friend class StaticContainer;
+			/// Resolves through the root binding of T if Freeze() has determined it
+			Injection(Container &container, Binding *target) : value(target ? container.ResolveLink<T>(nullptr, *target, interned_id<id>, 0u) : container.ResolveInterface<T, id>()) {}
+			/// Takes an instance resolved by a StaticContainer
+			Injection(std::in_place_t, std::shared_ptr<T> value_) : value(std::move(value_)) {}
 		};
 
-		template <class T>
+		/// \brief Injects the link of the interface T whose id is passed as an argument of type TId when resolving
+		/// \details TId can be std::string, std::string_view or RuntimeId; an interned RuntimeId is looked up without hashing it
+		template <class T, typename TId = std::string>
 		struct InjectionRuntimeResolved{
-			InjectionRuntimeResolved(std::shared_ptr<Container> container, std::string id) : value(container->ResolveInterfaceRuntimeId<T>(id)) {}
+			InjectionRuntimeResolved(std::shared_ptr<Container> container, const TId &id) : value(container->ResolveInterfaceRuntimeId<T>(id)) {}
 			std::shared_ptr<T> value;
 			operator const std::shared_ptr<T> &() {return value;} // NOLINT(google-explicit-constructor)
+		private:
+			friend class Container;
+			/// Resolves through the root binding of T if Freeze() has determined it
+			InjectionRuntimeResolved(Container &container, const TId &id, Binding *target) : value(target ? container.ResolveLink<T>(nullptr, *target, id, 0u) : container.ResolveInterfaceRuntimeId<T>(id)) {}
 		};
 
+		/// \brief All parameterless linked implementations of the interface T
+		/// \details If all links point to Singletons, the instances are shared by all MultipleInjections of T until a link is added
 		template<class T>
 		struct MultipleInjection{
-			explicit MultipleInjection(std::shared_ptr<Container> container) : value(container->ResolveAll<T>()) {}
-			std::vector<std::shared_ptr<T>> value;
+		private:
+			/// Owns value
+			std::shared_ptr<const std::vector<std::shared_ptr<T>>> snapshot;
+		public:
+			explicit MultipleInjection(std::shared_ptr<Container> container) : MultipleInjection(container->ResolveAll<T>()) {}
+			const std::vector<std::shared_ptr<T>> &value;
 			operator const std::vector<std::shared_ptr<T>> &() {return value;} // NOLINT(google-explicit-constructor)
+			auto begin() const {return value.begin();}
+			auto end() const {return value.end();}
+			[[nodiscard]] std::size_t size() const {return value.size();}
+		private:
+			friend class Container;
+			template <typename...> friend class StaticContainer;
+			explicit MultipleInjection(std::shared_ptr<const std::vector<std::shared_ptr<T>>> snapshot_) : snapshot(std::move(snapshot_)), value(*snapshot) {}
+			/// Resolves through the root binding of T if Freeze() has determined it
+			MultipleInjection(Container &container, Binding *target) : MultipleInjection(target ? container.ResolveAllBound<T>(*target) : container.ResolveAll<T>()) {}
+			/// Takes the instances resolved by a StaticContainer
+			MultipleInjection(std::in_place_t, std::vector<std::shared_ptr<T>> value_) : MultipleInjection(std::make_shared<const std::vector<std::shared_ptr<T>>>(std::move(value_))) {}
 		};
 
 		template <class T>
@@ -76,22 +411,304 @@ namespace mabiphmo::ioc_container{
 			explicit Dependency(std::shared_ptr<Container> container) : value(container->Resolve<T>()) {}
 			std::shared_ptr<T> value;
 			operator const std::shared_ptr<T> &() {return value;} // NOLINT(google-explicit-constructor)
+		private:
+			friend class Container;
+			template <typename...> friend class StaticContainer;
+			/// Resolves through the root binding of T if Freeze() has determined it
+			Dependency(Container &container, Binding *target) : value(target ? container.ResolveBound<T>(nullptr, *target, 0u) : container.Resolve<T>()) {}
+			/// Takes an instance resolved by a StaticContainer
+			Dependency(std::in_place_t, std::shared_ptr<T> value_) : value(std::move(value_)) {}
 		};
-//endregion
-//region private
-	private:
-		template<typename TContainer>
-		struct container_hash {
-			std::size_t operator()(const TContainer &container) const{
-				return boost::hash_range(container.begin(), container.end());
+
+		/// \brief Dependency that is resolved on first access instead of when the factory is called
+		/// \details The instance is cached and shared by all copies of the Lazy; the first access may happen from any thread.
+		/// Only a weak reference to the container is kept, so accessing a Lazy after the container has been destroyed throws.
+		template <class T>
+		class Lazy{
+			friend class Container;
+			struct State{
+				std::once_flag once;
+				std::shared_ptr<T> value;
+			};
+
+			std::weak_ptr<Container> container_;
+			Binding *target_;
+			std::shared_ptr<State> state_;
+
+			/// Resolves through the root binding of T if Freeze() has determined it
+			Lazy(Container &container, Binding *target) : container_(container.weak_from_this()), target_(target), state_(std::make_shared<State>()) {}
+		public:
+			explicit Lazy(const std::shared_ptr<Container> &container) : Lazy(*container, nullptr) {}
+
+			/// Resolves T unless it has been resolved already
+			const std::shared_ptr<T> &Get() const
+			{
+				std::call_once(state_->once, [this](){
+					auto container = container_.lock();
+					if (!container)
+						throw ContainerException("Container is expired");
+					state_->value = target_ ? container->ResolveBound<T>(nullptr, *target_, 0u) : container->Resolve<T>();
+				});
+				return state_->value;
 			}
+			T *operator->() const { return Get().get(); }
+			T &operator*() const { return *Get(); }
+			operator const std::shared_ptr<T> &() const {return Get();} // NOLINT(google-explicit-constructor)
 		};
 
-		template<typename TContainer, typename TKey>
-		inline bool container_contains(const TContainer& container, const TKey& key)
-		{
-			return container.find(key) != container.end();
-		}
+		/// \brief Dependency that resolves T with the arguments TArgs on every call
+		/// \details Only a weak reference to the container is kept, so calling a Provider after the container has been destroyed throws.
+		template <class T, typename ... TArgs>
+		class Provider{
+			friend class Container;
+
+			std::weak_ptr<Container> container_;
+			Binding *target_;
+
+			/// Resolves through the binding of T for TArgs if Freeze() has determined it
+			Provider(Container &container, Binding *target) : container_(container.weak_from_this()), target_(target) {}
+		public:
+			explicit Provider(const std::shared_ptr<Container> &container) : Provider(*container, nullptr) {}
+
+			/// Resolves T
+			std::shared_ptr<T> operator()(TArgs ... args) const
+			{
+				auto container = container_.lock();
+				if (!container)
+					throw ContainerException("Container is expired");
+				if (target_)
+					return container->ResolveBound<T>(nullptr, *target_, movable_mask<TArgs...>(), args ...);
+				return container->Resolve<T>(std::move(args) ...);
+			}
+		};
+
+		/// \brief Handle that resolves T with the argument signature TArgs without looking anything up
+		/// \details Created by GetResolver, which finds the binding and picks the code path for T's scope once. Calling the resolver only loads
+		/// the current factory (or singleton instance) of that binding, so registering afterwards - even replacing the factory - cannot invalidate it.
+		/// A resolver must not be used after the container it was created by has been destroyed.
+		template <class T, typename ... TArgs>
+		class Resolver{
+			friend class Container;
+			using invoke_t = std::shared_ptr<T> (*)(Container &, Binding &, unsigned, TArgs &...);
+
+			Container *container_;
+			Binding *binding_;
+			invoke_t invoke_;
+
+			Resolver(Container &container, Binding &binding, invoke_t invoke) : container_(&container), binding_(&binding), invoke_(invoke) {}
+		public:
+			/// Resolves T
+			/// \param args The arguments that will be used when resolving; their plain types have to be TArgs
+			/// \return The resolved instance
+			template <typename ... TCallArgs>
+			std::shared_ptr<T> operator()(TCallArgs &&... args) const
+			{
+				static_assert(std::is_same_v<std::tuple<std::remove_cvref_t<TCallArgs>...>, std::tuple<TArgs...>>, "The arguments do not match the signature of the resolver");
+				return invoke_(*container_, *binding_, movable_mask<TCallArgs...>(), const_cast<TArgs &>(args) ...);
+			}
+		};
+
+		/// \brief Factory parameter that supplies the memory resource instances should be allocated from
+		/// \details In order of precedence this is the resource set for the type the factory creates, the arena of the ResolveN creating the type,
+		/// the arena of the current ResolutionScope, the resource set for the container or the default memory resource (see SetMemoryResource).
+		/// pmr-aware types created through MakeShared receive the allocator as well (uses-allocator construction).
+		struct Allocator{
+			explicit Allocator(const std::shared_ptr<Container> &container) : value(container->CurrentResource(nullptr)) {}
+			std::pmr::polymorphic_allocator<std::byte> value;
+			operator const std::pmr::polymorphic_allocator<std::byte> &() {return value;} // NOLINT(google-explicit-constructor)
+
+			/// Creates an instance of T whose object and control block come from the memory resource
+			template <class T, typename ... TArgs>
+			std::shared_ptr<T> MakeShared(TArgs &&... args) const
+			{
+				return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(value), std::forward<TArgs>(args) ...);
+			}
+		private:
+			friend class Container;
+			/// \param root Root binding of the type the factory creates
+			Allocator(Container &container, Binding *root) : value(container.CurrentResource(root)) {}
+		};
+
+		/// \brief Short-lived scope (e.g. a request) in which each Scoped type is created at most once
+		/// \details Scoped types can only be resolved through a scope - also as dependencies of types resolved through it.
+		/// The bookkeeping of a scope lives in an arena owned by the scope (its first KiB inside the scope object itself, the rest comes from an upstream resource),
+		/// which is also what Allocator supplies to factories run within the scope. All instances are destroyed together, in reverse order of creation, when the scope ends,
+		/// so instances allocated from the arena must not outlive the scope. A scope must only be used by one thread at a time.
+		class ResolutionScope{
+			friend class Container;
+
+			/// Scope the current thread is resolving through
+			static inline thread_local ResolutionScope *current_ = nullptr;
+
+			std::shared_ptr<Container> container_;
+			alignas(std::max_align_t) std::byte buffer_[1024];
+			std::pmr::monotonic_buffer_resource arena_;
+			std::pmr::vector<std::pair<const Binding *, std::shared_ptr<void>>> instances_;
+
+			/// \return The instance of the (root) binding in this scope or nullptr
+			const std::shared_ptr<void> *Find(const Binding *root) const noexcept
+			{
+				for (const auto &instance : instances_)
+					if (instance.first == root)
+						return &instance.second;
+				return nullptr;
+			}
+		public:
+			/// Creates a new scope
+			/// \param container The container types are resolved from
+			/// \param upstream Where the arena gets more memory from once its inline buffer is exhausted
+			explicit ResolutionScope(std::shared_ptr<Container> container, std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+				: container_(std::move(container)), buffer_(), arena_(buffer_, sizeof(buffer_), upstream), instances_(&arena_) {}
+			ResolutionScope(const ResolutionScope &) = delete;
+			ResolutionScope &operator=(const ResolutionScope &) = delete;
+			~ResolutionScope()
+			{
+				while (!instances_.empty())
+					instances_.pop_back();
+			}
+
+			/// Resolves the type T with the supplied arguments within this scope
+			/// \tparam T The type to resolve
+			/// \tparam TArgs The type of the arguments that will be used when resolving
+			/// \param args The arguments that will be used when resolving
+			/// \return The resolved instance
+			template <class T, typename ... TArgs>
+			std::shared_ptr<T> Resolve(TArgs &&... args)
+			{
+				struct CurrentGuard{
+					explicit CurrentGuard(ResolutionScope *scope) : previous(current_) { current_ = scope; }
+					~CurrentGuard() { current_ = previous; }
+					ResolutionScope *previous;
+				} guard(this);
+				return container_->Resolve<T>(std::forward<TArgs>(args) ...);
+			}
+
+			/// The arena of the scope
+			std::pmr::memory_resource &Resource() noexcept
+			{
+				return arena_;
+			}
+		};
+
+		/// Result of WarmUp
+		struct WarmUpReport{
+			struct Entry{
+				/// Pretty name of the singleton
+				std::string name;
+				/// Time the construction took
+				std::chrono::nanoseconds duration;
+				/// What the construction threw or nullptr
+				std::exception_ptr error;
+			};
+			/// Wall-clock time of the whole warm-up
+			std::chrono::nanoseconds total{};
+			/// One entry per singleton, in order of completion
+			std::vector<Entry> entries;
+
+			/// Whether every singleton has been constructed
+			[[nodiscard]] bool Succeeded() const noexcept
+			{
+				return std::none_of(entries.begin(), entries.end(), [](const Entry &entry){ return static_cast<bool>(entry.error); });
+			}
+		};
+
+		/// What has been recorded for a type since the container was created (see GetMetrics)
+		struct TypeMetrics{
+			/// Number of buckets of factoryTime
+			static constexpr std::size_t histogramBuckets = 40;
+
+			/// Pretty name of the type
+			std::string name;
+			/// Number of times the type has been resolved, directly or as a dependency; for an interface this counts resolving it, not its links
+			std::uint64_t resolves = 0;
+			/// Number of resolves of a Singleton or Scoped type that returned an existing instance
+			std::uint64_t instanceHits = 0;
+			/// Number of factory calls that returned
+			std::uint64_t factoryCalls = 0;
+			/// \brief Histogram of the time the factory calls took, including resolving their dependencies
+			/// \details Bucket 0 counts calls below 1ns, bucket i calls from 2^(i-1)ns to below 2^i ns; the last bucket also counts everything longer
+			std::array<std::uint64_t, histogramBuckets> factoryTime{};
+			/// Deepest nesting the type has been resolved in; 1 means resolved directly, 2 as a dependency of a type resolved directly and so on
+			unsigned maxDepth = 0;
+		};
+
+		/// Snapshot of the metrics of all registered types
+		struct MetricsSnapshot{
+			/// Whether metrics are recorded at all (IOC_CONTAINER_METRICS is defined)
+			bool enabled = false;
+			/// One entry per registered type
+			std::vector<TypeMetrics> types;
+		};
+
+		/// Why a TryResolve failed
+		enum class ResolveError{
+			/// Nothing has been registered for the type
+			NotRegistered,
+			/// The type has neither an instance nor a factory for the supplied arguments
+			NoFactory,
+			/// The interface has no link for the supplied arguments or id
+			NoLink,
+			/// The type has been registered, but not as an Interface
+			NotAnInterface,
+			/// A Scoped type has been resolved outside of a ResolutionScope of the container
+			NoResolutionScope,
+			/// The type has been registered with an invalid Scope
+			InvalidScope
+		};
+
+		/// \brief Reason a TryResolve failed
+		/// \details Creating a failure costs no more than a few stores, the message is only formatted (and the type name demangled) by Message()
+		class ResolveFailure{
+		public:
+			[[nodiscard]] ResolveError Code() const noexcept {return code_;}
+			/// The message the ContainerException thrown by Resolve would have had
+			[[nodiscard]] std::string Message() const
+			{
+				return prefix_ + name_() + suffix_;
+			}
+		private:
+			friend class Container;
+			template <class> friend class ResolveResult;
+			ResolveFailure() = default;
+			ResolveFailure(ResolveError code, const char *prefix, std::string (*name)(), const char *suffix) noexcept : code_(code), prefix_(prefix), name_(name), suffix_(suffix) {}
+			ResolveError code_{};
+			const char *prefix_ = "";
+			/// Pretty name of the type; nullptr unless resolving failed
+			std::string (*name_)() = nullptr;
+			const char *suffix_ = "";
+		};
+
+		/// \brief Instance of T or the reason it could not be resolved, returned by TryResolve
+		template <class T>
+		class ResolveResult{
+		public:
+			/// Whether T has been resolved
+			[[nodiscard]] bool HasValue() const noexcept {return !failure_.name_;}
+			explicit operator bool() const noexcept {return HasValue();}
+			/// The resolved instance or nullptr if resolving failed
+			[[nodiscard]] const std::shared_ptr<T> &Get() const noexcept {return value_;}
+			/// The resolved instance; throws ContainerException if resolving failed
+			[[nodiscard]] const std::shared_ptr<T> &Value() const
+			{
+				if(!HasValue())
+					throw ContainerException(failure_.Message());
+				return value_;
+			}
+			T *operator->() const noexcept {return value_.get();}
+			T &operator*() const noexcept {return *value_;}
+			/// Why resolving failed; only meaningful if HasValue() is false
+			[[nodiscard]] const ResolveFailure &Error() const noexcept {return failure_;}
+		private:
+			friend class Container;
+			ResolveResult() = default;
+			std::shared_ptr<T> value_;
+			ResolveFailure failure_;
+		};
+//endregion
+//region private
+	private:
+		/// Restricts constructing a child container to CreateChild
+		struct child_tag{ explicit child_tag() = default; };
 
 		/// Scopes of types in the container
 		enum class Scope{
@@ -100,8 +717,183 @@ namespace mabiphmo::ioc_container{
 			/// Each time an instance is asked for, a new one will be created
 			Transient,
 			/// There will (cannot) be any instances of this, however instances of linked types will be resolved
-			Interface
+			Interface,
+			/// A single instance per ResolutionScope
+			Scoped
+		};
+
+		/// A type linked to an interface
+		struct link{
+			/// factory_t<TInterface, TArgs...>
+			std::shared_ptr<void> factory;
+			/// Key of the root binding of the linked type
+			TypeKey target;
+		};
+
+		/// Links by id - the last registered link comes first
+		using link_table = std::unordered_map<RuntimeId, std::vector<link>, RuntimeId::hash, RuntimeId::equal>;
+
+		/// RuntimeId of a compile time id, interned once
+		template <FixedString id>
+		static inline const RuntimeId interned_id{std::string_view(id)};
+
+		/// \brief ResolveAll result cached on the root binding of an interface
+		/// \details A snapshot is only cached if all links point to Singletons, so resolving them again would yield the same instances.
+		/// It is stale once a link has been added, which replaces the link table.
+		template <class T>
+		struct all_snapshot{
+			explicit all_snapshot(const link_table *table_) : table(table_) {}
+			/// Link table the snapshot has been resolved from
+			const link_table *const table;
+			std::vector<std::shared_ptr<T>> instances;
+		};
+
+		/// The arena of the ResolveN running on this thread, which only the Allocator of the type it creates supplies
+		struct batch_arena{
+			/// Root binding of the type ResolveN creates
+			const Binding *root = nullptr;
+			std::pmr::memory_resource *resource = nullptr;
+			/// Whether an Allocator has supplied resource
+			bool used = false;
+		};
+
+		/// Keeps the instances created by ResolveN alive together with the arena they have been allocated from
+		template <class T>
+		struct batch{
+			explicit batch(std::size_t bytes) : arena(bytes) {}
+			std::pmr::monotonic_buffer_resource arena;
+			/// Declared after arena, so they are destroyed before it
+			std::vector<std::shared_ptr<T>> instances;
+		};
+
+		/// How a dependency gets resolved
+		enum class DependencyKind{
+			/// Dependency<T> or the type a link points to: resolved like Resolve<T>(args...)
+			Resolve,
+			/// Injection<T, id>: the link with a fixed id
+			Interface,
+			/// InjectionRuntimeResolved<T>: a link whose id is only known when resolving
+			InterfaceRuntimeId,
+			/// MultipleInjection<T>: all links
+			All,
+			/// Allocator: nothing to resolve
+			Allocator
+		};
+
+		/// \brief A type a factory or link needs in order to resolve
+		/// \details Recorded when registering so the registrations can be checked without constructing anything. <b>target</b> is set by Freeze()
+		/// and lets the factory resolve the dependency without looking it up
+		struct DependencyInfo{
+			DependencyInfo(DependencyKind kind_, TypeKey root_, TypeKey signature_, std::string id_, std::string (*name_)(), bool deferred_ = false)
+				: kind(kind_), root(root_), signature(signature_), id(std::move(id_)), name(name_), deferred(deferred_) {}
+
+			const DependencyKind kind;
+			/// Key of the root binding of the required type
+			const TypeKey root;
+			/// Key of the binding of the required type with the arguments it is resolved with
+			const TypeKey signature;
+			/// Id of the required link (Interface only)
+			const std::string id;
+			/// Pretty name of the required type
+			std::string (*const name)();
+			/// Whether the dependency is only resolved when it is used (Lazy, Provider) instead of when the factory is called
+			const bool deferred;
+			/// Binding the dependency gets resolved through, once validated
+			std::atomic<Binding *> target{nullptr};
 		};
+
+#ifdef IOC_CONTAINER_METRICS
+		/// Counters behind TypeMetrics
+		struct type_metrics{
+			std::atomic<std::uint64_t> resolves{0};
+			std::atomic<std::uint64_t> instanceHits{0};
+			std::atomic<std::uint64_t> factoryCalls{0};
+			std::array<std::atomic<std::uint64_t>, TypeMetrics::histogramBuckets> factoryTime{};
+			std::atomic<unsigned> maxDepth{0};
+		};
+#else
+		struct type_metrics{};
+#endif
+
+		/// \brief Everything registered for a type with one specific argument signature
+		/// \details Everything that can change after the binding has been published is reached through an atomic pointer to immutable data,
+		/// so resolving can read a binding while it is being registered on.
+		struct Binding{
+			Binding(Container *owner_, Scope scope_, Binding *root_, std::string (*name_)()) : owner(owner_), scope(scope_), root(root_ ? root_ : this), name(name_) {}
+			Binding(const Binding &) = delete;
+			Binding &operator=(const Binding &) = delete;
+			~Binding(){
+				delete instance.load(std::memory_order_relaxed);
+			}
+
+			/// Container the binding has been registered in
+			Container *const owner;
+			const Scope scope;
+			/// Binding of the type without arguments, which holds the state shared by all signatures of the type
+			Binding *const root;
+			/// Pretty name of the type
+			std::string (*const name)();
+			/// factory_t<T, TArgs...> or nullptr
+			std::atomic<const void *> factory{nullptr};
+			/// Linked types or nullptr; replaced as a whole whenever a link is added
+			std::atomic<const link_table *> links{nullptr};
+			/// all_snapshot<T> of the links without arguments or nullptr
+			std::atomic<std::shared_ptr<const void>> all;
+			/// What the factory or the links need in order to resolve; only accessed while registering is locked
+			std::vector<std::shared_ptr<DependencyInfo>> dependencies;
+
+			//only used on the root binding
+			/// Singleton instance or nullptr; once set it never changes
+			std::atomic<const std::shared_ptr<void> *> instance{nullptr};
+			/// Held while the singleton instance is constructed
+			std::mutex instanceMutex;
+			/// Thread that holds instanceMutex; used to detect a singleton depending on itself
+			std::atomic<std::thread::id> constructingThread{};
+			std::atomic<std::size_t> factoryCount{0};
+			std::atomic<std::size_t> linkCount{0};
+			/// Memory resource Allocator supplies to the factories of the type or nullptr
+			std::atomic<std::pmr::memory_resource *> resource{nullptr};
+			/// Constructs the singleton instance through the factory without arguments, if there is one; only accessed while registering is locked
+			void (*construct)(Container &, Binding &) = nullptr;
+			/// Starts constructing the singleton instance on a thread of its own (see StartConstruction); set along with construct
+			void (*constructAsync)(Container &, Binding &) = nullptr;
+			/// std::shared_future<std::shared_ptr<T>> of the construction started by StartConstruction or nullptr; only accessed while asyncMutex_ is held
+			std::shared_ptr<void> pending;
+			/// Empty unless IOC_CONTAINER_METRICS is defined
+			[[no_unique_address]] type_metrics metrics;
+		};
+
+		/// Arguments are identified by their plain type, so a factory can be resolved with lvalues, rvalues and const arguments alike
+		template <typename TArg>
+		using arg_t = std::remove_cvref_t<TArg>;
+
+		/// \brief Canonical signature factories and links are stored with
+		/// \details The container that resolves is passed along, so nested resolves neither lock nor copy a pointer to it.
+		/// All arguments are passed as lvalues, bit i of the second parameter is set if argument i may be moved from
+		template <class T, typename... TArgs>
+		using factory_t = Invoker<std::shared_ptr<T>(Container &, unsigned, TArgs &...)>;
+
+		/// Bitmask of the arguments that have been supplied as rvalues (see factory_t)
+		template <typename... TArgs>
+		static constexpr unsigned movable_mask(){
+			static_assert(sizeof...(TArgs) <= sizeof(unsigned) * 8, "Too many arguments");
+			unsigned mask = 0, bit = 1;
+			((mask |= std::is_lvalue_reference_v<TArgs> ? 0u : bit, bit <<= 1u), ...);
+			return mask;
+		}
+
+		/// Converts an argument passed in its canonical form (see factory_t) to what the parameter TParam of a factory expects
+		template <typename TParam, typename TArg>
+		static decltype(auto) PassArgument(TArg &arg, bool movable){
+			if constexpr (std::is_lvalue_reference_v<TParam>)
+				return static_cast<TParam>(arg);
+			else if constexpr (!std::is_copy_constructible_v<TArg>)
+				return TArg(std::move(arg));
+			else if constexpr (!std::is_move_constructible_v<TArg>)
+				return TArg(arg);
+			else
+				return movable ? TArg(std::move(arg)) : TArg(arg);
+		}
 //region Dependency Type Resolving
 		template <typename... Ts>
 		struct list {};
@@ -114,9 +906,9 @@ namespace mabiphmo::ioc_container{
 				partition<list<>, DependencyList, RuntimeDependencyList, RuntimeDependencyStringList, list<Head, Tail...>>
 		{};
 
-		template <typename Head, typename ... Tail, typename DependencyList, typename ... RuntimeDependencies, typename ... RuntimeDependencyStrings>
-		struct partition<list<InjectionRuntimeResolved<Head>, Tail...>, DependencyList, list<RuntimeDependencies...>, list<RuntimeDependencyStrings...>, list<>> :
-				partition<list<Tail...>, DependencyList, list<RuntimeDependencies..., InjectionRuntimeResolved<Head>>, list<RuntimeDependencyStrings..., std::string>, list<>>
+		template <typename Head, typename HeadId, typename ... Tail, typename DependencyList, typename ... RuntimeDependencies, typename ... RuntimeDependencyStrings>
+		struct partition<list<InjectionRuntimeResolved<Head, HeadId>, Tail...>, DependencyList, list<RuntimeDependencies...>, list<RuntimeDependencyStrings...>, list<>> :
+				partition<list<Tail...>, DependencyList, list<RuntimeDependencies..., InjectionRuntimeResolved<Head, HeadId>>, list<RuntimeDependencyStrings..., HeadId>, list<>>
 		{};
 
 		template <typename Head, FixedString HeadId, typename... Tail, typename... Dependencies>
@@ -134,23 +926,331 @@ namespace mabiphmo::ioc_container{
 				partition<list<Tail...>, list<Dependencies..., Dependency<Head>>, list<>, list<>, list<>>
 		{};
 
+		template <typename Head, typename... Tail, typename... Dependencies>
+		struct partition<list<Lazy<Head>, Tail...>, list<Dependencies...>, list<>, list<>, list<>> :
+				partition<list<Tail...>, list<Dependencies..., Lazy<Head>>, list<>, list<>, list<>>
+		{};
+
+		template <typename Head, typename... HeadArgs, typename... Tail, typename... Dependencies>
+		struct partition<list<Provider<Head, HeadArgs...>, Tail...>, list<Dependencies...>, list<>, list<>, list<>> :
+				partition<list<Tail...>, list<Dependencies..., Provider<Head, HeadArgs...>>, list<>, list<>, list<>>
+		{};
+
+		template <typename... Tail, typename... Dependencies>
+		struct partition<list<Allocator, Tail...>, list<Dependencies...>, list<>, list<>, list<>> :
+				partition<list<Tail...>, list<Dependencies..., Allocator>, list<>, list<>, list<>>
+		{};
+
 		template <typename DependencyList, typename RuntimeDependencyList, typename RuntimeDependencyStringList, typename ArgsList>
 		struct partition<list<>, DependencyList, RuntimeDependencyList, RuntimeDependencyStringList, ArgsList> { using type [[maybe_unused]] = list<DependencyList, RuntimeDependencyList, RuntimeDependencyStringList, ArgsList>; };
 
 		template <typename... Ts>
 		using register_traits = typename partition<list<Ts...>, list<>, list<>, list<>, list<>>::type;
+
+		template <typename TFunction>
+		struct factory_signature;
+
+		template <class T, typename ... TArgs>
+		struct factory_signature<std::function<std::shared_ptr<T>(TArgs ...)>>{
+			using type [[maybe_unused]] = T;
+			using traits [[maybe_unused]] = register_traits<TArgs...>;
+		};
+
+		/// The type a factory of type F creates and its register_traits; F can be any callable with a single signature (not only std::function)
+		template <typename F>
+		using factory_traits = factory_signature<decltype(std::function(std::declval<std::decay_t<F>>()))>;
+
+		template <typename TFunction>
+		struct async_factory_signature;
+
+		template <class T, template <typename> class TFuture, typename ... TArgs>
+		requires std::is_same_v<TFuture<std::shared_ptr<T>>, std::future<std::shared_ptr<T>>> || std::is_same_v<TFuture<std::shared_ptr<T>>, std::shared_future<std::shared_ptr<T>>>
+		struct async_factory_signature<std::function<TFuture<std::shared_ptr<T>>(TArgs ...)>>{
+			using type [[maybe_unused]] = T;
+
+			/// Turns an asynchronous factory into a synchronous one that waits for the instance
+			template <typename F>
+			static std::function<std::shared_ptr<T>(TArgs ...)> Wait(F &&factory){
+				return [factory = std::forward<F>(factory)](TArgs ... args) mutable { return factory(std::forward<TArgs>(args) ...).get(); };
+			}
+		};
+
+		/// The type an asynchronous factory of type F creates, see RegisterSingletonAsync
+		template <typename F>
+		using async_factory_traits = async_factory_signature<decltype(std::function(std::declval<std::decay_t<F>>()))>;
+
+		/// Pretty name of T; boost falls back to compile time type information if RTTI is disabled
+		template <class T>
+		static std::string pretty_name(){
+			return boost::typeindex::type_id<T>().pretty_name();
+		}
+
+		/// Reports that T could not be resolved through failure if TryResolve asked for it, otherwise throws
+		template <class T>
+		static void Fail(ResolveFailure *failure, ResolveError code, const char *prefix, const char *suffix)
+		{
+			auto res = ResolveFailure(code, prefix, &pretty_name<T>, suffix);
+			if(!failure)
+				throw ContainerException(res.Message());
+			*failure = res;
+		}
+
+		/// Describes the dependency a factory parameter of type TDependency stands for
+		template <typename TDependency, typename = void>
+		struct dependency_traits;
+
+		template <class T>
+		struct dependency_traits<Dependency<T>>{
+			static std::shared_ptr<DependencyInfo> Describe(){ return std::make_shared<DependencyInfo>(DependencyKind::Resolve, type_key<T>, type_key<T>, std::string(), &pretty_name<T>); }
+		};
+
+		template <class T, FixedString id>
+		struct dependency_traits<Injection<T, id>>{
+			static std::shared_ptr<DependencyInfo> Describe(){ return std::make_shared<DependencyInfo>(DependencyKind::Interface, type_key<T>, type_key<T>, std::string(id), &pretty_name<T>); }
+		};
+
+		template <class T, typename TId>
+		struct dependency_traits<InjectionRuntimeResolved<T, TId>>{
+			static std::shared_ptr<DependencyInfo> Describe(){ return std::make_shared<DependencyInfo>(DependencyKind::InterfaceRuntimeId, type_key<T>, type_key<T>, std::string(), &pretty_name<T>); }
+		};
+
+		template <class T>
+		struct dependency_traits<MultipleInjection<T>>{
+			static std::shared_ptr<DependencyInfo> Describe(){ return std::make_shared<DependencyInfo>(DependencyKind::All, type_key<T>, type_key<T>, std::string(), &pretty_name<T>); }
+		};
+
+		template <class T>
+		struct dependency_traits<Lazy<T>>{
+			static std::shared_ptr<DependencyInfo> Describe(){ return std::make_shared<DependencyInfo>(DependencyKind::Resolve, type_key<T>, type_key<T>, std::string(), &pretty_name<T>, true); }
+		};
+
+		template <class T, typename ... TArgs>
+		struct dependency_traits<Provider<T, TArgs...>>{
+			static std::shared_ptr<DependencyInfo> Describe(){ return std::make_shared<DependencyInfo>(DependencyKind::Resolve, type_key<T>, type_key<T, TArgs...>, std::string(), &pretty_name<T>, true); }
+		};
+
+		template <typename TDummy>
+		struct dependency_traits<Allocator, TDummy>{
+			static std::shared_ptr<DependencyInfo> Describe(){ return std::make_shared<DependencyInfo>(DependencyKind::Allocator, type_key<Allocator>, type_key<Allocator>, std::string(), &pretty_name<Allocator>); }
+		};
 //endregion
 //endregion
 //endregion
 //region Member Variables
-		std::unordered_map<std::type_index, Scope> registeredTypes_;
-		std::unordered_map<std::type_index, std::unordered_map<std::vector<std::type_index>, std::shared_ptr<void>, container_hash<std::vector<std::type_index>>>> registeredFactories_;
-		std::unordered_map<std::type_index, std::shared_ptr<void>> registeredInstances_;
-		std::unordered_map<std::type_index, std::unordered_map<std::vector<std::type_index>, std::unordered_map<std::string, std::vector<std::shared_ptr<void>>>, container_hash<std::vector<std::type_index>>>> registeredLinks_;
+		/// All bindings, keyed by type_key<T, arg_t<TArgs>...>; the key type_key<T> holds the root binding of T
+		FlatMap<Binding> bindings_;
+		/// Serializes registering; resolving never takes it
+		mutable std::mutex registrationMutex_;
+		/// Keeps factories and replaced link tables alive, bindings only point to them
+		std::vector<std::shared_ptr<const void>> retained_;
+		/// Set by Freeze(); no registering is possible afterwards
+		std::atomic<bool> frozen_{false};
+		/// Memory resource Allocator supplies outside of a ResolutionScope or nullptr
+		std::atomic<std::pmr::memory_resource *> resource_{nullptr};
+		/// Guards Binding::pending
+		std::mutex asyncMutex_;
+		/// Container types that are not registered in this one are resolved through (see CreateChild) or nullptr
+		std::shared_ptr<Container> parent_;
+		/// See batch_arena
+		static inline thread_local batch_arena currentBatch_{nullptr, nullptr, false};
 //endregion
 //region Functions
 //region private
+//region Bindings
+		/// Creates the root binding of T
+		/// \param scope Scope T is registered as
+		template <class T>
+		Binding &AddRoot(Scope scope)
+		{
+			return bindings_.TryEmplace(type_key<T>, this, scope, nullptr, &pretty_name<T>).first;
+		}
+
+		/// Throws if the container has been frozen
+		/// \tparam T The type that should be registered
+		template <class T>
+		void EnsureNotFrozen() const
+		{
+			if (frozen_.load(std::memory_order_relaxed)){
+				auto ss = std::ostringstream();
+				ss << "Container is frozen. Cannot register " << pretty_name<T>();
+				throw ContainerException(ss.str());
+			}
+		}
+
+		/// Returns the binding of T for the argument signature TArgs, creating it if necessary
+		/// \param root The root binding of T
+		template <class T, typename... TArgs>
+		Binding &Bind(Binding &root)
+		{
+			if constexpr (sizeof...(TArgs) == 0)
+				return root;
+			else
+				return bindings_.TryEmplace(type_key<T, TArgs...>, this, root.scope, &root, root.name).first;
+		}
+
+		/// \brief Root binding of a type in the closest container that has registered it: this one or one of its ancestors
+		/// \param key Key of the root binding
+		/// \return The root binding or nullptr if the type is not registered anywhere
+		Binding *FindRoot(const TypeKey &key) const noexcept
+		{
+			for (auto container = this; container; container = container->parent_.get())
+				if (auto root = container->bindings_.Find(key))
+					return root;
+			return nullptr;
+		}
+
+		/// \brief Binding of a type for an argument signature in the closest container that has registered the type
+		/// \details Registering a type in a child container hides all of the parent's bindings of that type
+		/// \param signature Key of the binding
+		/// \param key Key of the root binding of the type
+		/// \return The binding or nullptr if there is none
+		Binding *FindBinding(const TypeKey &signature, const TypeKey &key) const noexcept
+		{
+			if (auto binding = bindings_.Find(signature))
+				return binding;
+			if (!parent_)
+				return nullptr;
+			auto root = FindRoot(key);
+			return root ? root->owner->bindings_.Find(signature) : nullptr;
+		}
+
+		/// \brief Constructs the singleton instance of a root binding exactly once
+		/// \details Concurrent callers wait for the construction to finish. If the factory throws, the instance stays unset and the next resolve tries again
+		/// \return The instance of the binding
+		template <class T, typename ... TArgs>
+		static const std::shared_ptr<void> &ConstructInstance(Container &container, Binding &root, const factory_t<T, TArgs...> &factory, unsigned movable, TArgs &... args)
+		{
+			if (root.constructingThread.load(std::memory_order_relaxed) == std::this_thread::get_id()){
+				auto ss = std::ostringstream();
+				ss << "Singleton " << pretty_name<T>() << " depends on itself";
+				throw ContainerException(ss.str());
+			}
+
+			std::lock_guard lock(root.instanceMutex);
+			if (auto instance = root.instance.load(std::memory_order_acquire)){
+				RecordInstanceHit(root);
+				return *instance;
+			}
+
+			struct ConstructionGuard{
+				explicit ConstructionGuard(Binding &root_) : root(root_) { root.constructingThread.store(std::this_thread::get_id(), std::memory_order_relaxed); }
+				~ConstructionGuard() { root.constructingThread.store(std::thread::id(), std::memory_order_relaxed); }
+				Binding &root;
+			} guard(root);
+			return PublishInstance(root, CallFactory<T>(container, root, factory, movable, args ...));
+		}
+
+//region Metrics
+		/// Records a resolve of a type and its nesting depth while alive; does nothing unless IOC_CONTAINER_METRICS is defined
+		struct resolve_record{
+#ifdef IOC_CONTAINER_METRICS
+			/// Number of resolves in progress on this thread
+			static inline thread_local unsigned depth = 0;
+
+			explicit resolve_record(Binding &root) noexcept
+			{
+				auto current = ++depth;
+				root.metrics.resolves.fetch_add(1, std::memory_order_relaxed);
+				auto max = root.metrics.maxDepth.load(std::memory_order_relaxed);
+				while (current > max && !root.metrics.maxDepth.compare_exchange_weak(max, current, std::memory_order_relaxed)) {}
+			}
+			~resolve_record() { --depth; }
+			resolve_record(const resolve_record &) = delete;
+			resolve_record &operator=(const resolve_record &) = delete;
+#else
+			explicit resolve_record(Binding &) noexcept {}
+#endif
+		};
+
+		/// Records that a resolve returned an existing instance
+		static void RecordInstanceHit([[maybe_unused]] Binding &root) noexcept
+		{
+#ifdef IOC_CONTAINER_METRICS
+			root.metrics.instanceHits.fetch_add(1, std::memory_order_relaxed);
+#endif
+		}
+
+		/// Calls a factory of the type of root, recording the call and its duration
+		template <class T, typename ... TArgs>
+		static std::shared_ptr<T> CallFactory(Container &container, [[maybe_unused]] Binding &root, const factory_t<T, TArgs...> &factory, unsigned movable, TArgs &... args)
+		{
+#ifdef IOC_CONTAINER_METRICS
+			auto begin = std::chrono::steady_clock::now();
+			auto instance = factory(container, movable, args ...);
+			auto nanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+			auto bucket = std::min<std::size_t>(std::bit_width(nanoseconds), TypeMetrics::histogramBuckets - 1);
+			root.metrics.factoryCalls.fetch_add(1, std::memory_order_relaxed);
+			root.metrics.factoryTime[bucket].fetch_add(1, std::memory_order_relaxed);
+			return instance;
+#else
+			return factory(container, movable, args ...);
+#endif
+		}
+//endregion
+
+		/// Binding::construct of a Singleton T
+		template <class T>
+		static void ConstructSingleton(Container &container, Binding &root)
+		{
+			ConstructInstance<T>(container, root, *static_cast<const factory_t<T> *>(root.factory.load(std::memory_order_acquire)), 0u);
+		}
+
+		/// Resolver::invoke_t for a Singleton
+		template <class T, typename ... TArgs>
+		static std::shared_ptr<T> InvokeSingleton(Container &, Binding &binding, unsigned movable, TArgs &... args)
+		{
+			resolve_record record(*binding.root);
+			if (auto instance = binding.root->instance.load(std::memory_order_acquire)){
+				RecordInstanceHit(*binding.root);
+				return std::static_pointer_cast<T>(*instance);
+			}
+			return std::static_pointer_cast<T>(ConstructInstance<T>(*binding.owner, *binding.root, *static_cast<const factory_t<T, TArgs...> *>(binding.factory.load(std::memory_order_acquire)), movable, args ...));
+		}
+
+		/// Resolver::invoke_t for a Transient
+		template <class T, typename ... TArgs>
+		static std::shared_ptr<T> InvokeTransient(Container &container, Binding &binding, unsigned movable, TArgs &... args)
+		{
+			resolve_record record(*binding.root);
+			return CallFactory<T>(container, *binding.root, *static_cast<const factory_t<T, TArgs...> *>(binding.factory.load(std::memory_order_acquire)), movable, args ...);
+		}
+
+		/// Resolver::invoke_t for a Scoped type
+		template <class T, typename ... TArgs>
+		static std::shared_ptr<T> InvokeScoped(Container &container, Binding &binding, unsigned movable, TArgs &... args)
+		{
+			resolve_record record(*binding.root);
+			return container.ResolveScoped<T>(nullptr, binding, *static_cast<const factory_t<T, TArgs...> *>(binding.factory.load(std::memory_order_acquire)), movable, args ...);
+		}
+
+		/// Resolver::invoke_t for an Interface
+		template <class T, typename ... TArgs>
+		static std::shared_ptr<T> InvokeInterface(Container &container, Binding &binding, unsigned movable, TArgs &... args)
+		{
+			return container.ResolveLink<T>(nullptr, binding, RuntimeId(), movable, args ...);
+		}
+
+		/// Sets the singleton instance of a root binding unless it already has one
+		/// \return The instance of the binding, which is not the supplied one if another thread has been faster
+		static const std::shared_ptr<void> &PublishInstance(Binding &root, std::shared_ptr<void> instance)
+		{
+			auto holder = std::make_unique<const std::shared_ptr<void>>(std::move(instance));
+			const std::shared_ptr<void> *expected = nullptr;
+			if (root.instance.compare_exchange_strong(expected, holder.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+				return *holder.release();
+			return *expected;
+		}
+//endregion
 //region AddFactory
+		/// \brief Binding a factory resolves a dependency through or nullptr to look it up
+		/// \details What Freeze() has determined only holds for the container the factory has been registered in,
+		/// a child container resolving an inherited factory looks its dependencies up since it may override them
+		/// \param own Whether the container resolving is the one the factory has been registered in
+		static Binding *DependencyTarget(const DependencyInfo &dependency, bool own) noexcept
+		{
+			//the target of an Allocator is the type it allocates for, which does not depend on the container
+			return own || dependency.kind == DependencyKind::Allocator ? dependency.target.load(std::memory_order_acquire) : nullptr;
+		}
 
 		/// Adds the factory after matching dependencies and creating a new factory based on that
 		/// \tparam T Type that the factory creates
@@ -158,147 +1258,638 @@ namespace mabiphmo::ioc_container{
 		/// \tparam TMultipleDependencies Interface - dependencies that get resolved with ResolveAll()
 		/// \tparam TDependencies Other dependencies
 		/// \tparam TArgs Arguments that should be supplied when resolving
+		/// \param root The root binding of T
 		/// \param pFactory Factory method
 		template <typename T, typename F, typename... TDependencies, typename ... RuntimeDependencies, typename ... RuntimeDependencyStrings, typename... TArgs>
-		void AddFactoryImpl(list<list<TDependencies...>, list<RuntimeDependencies...>, list<RuntimeDependencyStrings...>, list<TArgs...>>, F && pFactory)
+		void AddFactoryImpl(list<list<TDependencies...>, list<RuntimeDependencies...>, list<RuntimeDependencyStrings...>, list<TArgs...>>, Binding &root, F && pFactory)
 		{
-			if (container_contains(registeredInstances_, typeid(T))){
+			if (root.instance.load(std::memory_order_acquire)){
 				auto ss = std::ostringstream();
-				ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " already has an instance registered. Cannot add another factory";
+				ss << "Type " << pretty_name<T>() << " already has an instance registered. Cannot add another factory";
 				throw ContainerException(ss.str());
 			}
 
-			auto new_factory = std::make_shared<std::function<std::shared_ptr<T>(RuntimeDependencyStrings &&..., TArgs &&...)>>(
-					[self_weak = weak_from_this(), factory = std::make_shared<F>(pFactory)](RuntimeDependencyStrings &&...dependencyStrings, TArgs &&... args) {
-						if(auto self = self_weak.lock())
-							return (*factory)(TDependencies(self) ..., RuntimeDependencies(self, std::forward<RuntimeDependencyStrings>(dependencyStrings)) ..., std::forward<TArgs>(args) ...);
-						throw ContainerException("Container is expired");
+			auto dependencies = std::array<std::shared_ptr<DependencyInfo>, sizeof...(TDependencies) + sizeof...(RuntimeDependencies)>{
+				dependency_traits<TDependencies>::Describe() ..., dependency_traits<RuntimeDependencies>::Describe() ...};
+			//an Allocator needs to know which type it allocates for
+			for (auto &dependency : dependencies)
+				if (dependency->kind == DependencyKind::Allocator)
+					dependency->target.store(&root, std::memory_order_relaxed);
+
+			auto new_factory = std::make_shared<factory_t<T, arg_t<RuntimeDependencyStrings> ..., arg_t<TArgs> ...>>(
+					[factory = std::forward<F>(pFactory), dependencies, owner = this](Container &self, unsigned movable, arg_t<RuntimeDependencyStrings> &...dependencyStrings, arg_t<TArgs> &... args) mutable {
+						return [&]<std::size_t ... IDependencies, std::size_t ... IStrings, std::size_t ... IArgs>(std::index_sequence<IDependencies...>, std::index_sequence<IStrings...>, std::index_sequence<IArgs...>){
+							[[maybe_unused]] auto own = &self == owner;
+							return factory(TDependencies(self, DependencyTarget(*dependencies[IDependencies], own)) ...,
+							               RuntimeDependencies(self, dependencyStrings, DependencyTarget(*dependencies[sizeof...(TDependencies) + IStrings], own)) ...,
+							               PassArgument<TArgs>(args, movable >> (sizeof...(RuntimeDependencyStrings) + IArgs) & 1u) ...);
+						}(std::index_sequence_for<TDependencies...>{}, std::index_sequence_for<RuntimeDependencyStrings...>{}, std::index_sequence_for<TArgs...>{});
 					});
 
 			//add the factory
-			registeredFactories_[typeid(T)][std::vector<std::type_index>{typeid(RuntimeDependencyStrings) ..., typeid(TArgs) ...}] = new_factory;
+			auto &binding = Bind<T, arg_t<RuntimeDependencyStrings> ..., arg_t<TArgs> ...>(root);
+			if (!binding.factory.exchange(new_factory.get(), std::memory_order_acq_rel))
+				++root.factoryCount;
+			if constexpr (sizeof...(RuntimeDependencyStrings) + sizeof...(TArgs) == 0)
+				if (root.scope == Scope::Singleton)
+				{
+					root.construct = &ConstructSingleton<T>;
+					root.constructAsync = &ConstructSingletonAsync<T>;
+				}
+			binding.dependencies.assign(dependencies.begin(), dependencies.end());
+			retained_.emplace_back(std::move(new_factory));
+		}
+
+		/// Needed for dependency matching; see <b>AddFactoryImpl</b>
+		/// \tparam F Type of the factory
+		/// \param root The root binding of the type the factory creates
+		/// \param pFactory Factory method
+		template <typename F>
+		void AddFactory(Binding &root, F && pFactory)
+		{
+			return AddFactoryImpl<typename factory_traits<F>::type>(typename factory_traits<F>::traits{}, root, std::forward<F>(pFactory));
+		}
+//endregion
+//region AddLink
+		/// Adds a link between TInterface and T
+		/// \tparam T The type to link to
+		/// \tparam TInterface The Interface to link
+		/// \tparam TRemainingArgs Arguments that should be supplied when resolving
+		/// \tparam TArgs Arguments that are defined for the link
+		/// \param root The root binding of TInterface
+		/// \param id Id of the link
+		/// \param args Arguments that are defined for the link
+		template <class TInterface, class T, typename ... TRemainingArgs, typename ... TArgs>
+		void AddLink(Binding &root, const RuntimeId &id, TArgs &&... args) {
+			auto &binding = Bind<TInterface, arg_t<TRemainingArgs> ...>(root);
+			auto current = binding.links.load(std::memory_order_acquire);
+			auto table = current ? std::make_shared<link_table>(*current) : std::make_shared<link_table>();
+			auto &links = (*table)[id];
+			auto dependency = std::make_shared<DependencyInfo>(DependencyKind::Resolve, type_key<T>, type_key<T, arg_t<TArgs> ..., arg_t<TRemainingArgs> ...>, std::string(), &pretty_name<T>);
+			links.insert(links.cbegin(), link{std::make_shared<factory_t<TInterface, arg_t<TRemainingArgs> ...>>(
+					[dependency, owner = this, args = std::tuple<TArgs ...>(std::forward<TArgs>(args) ...)](Container &self, unsigned movable, arg_t<TRemainingArgs> &... remainingArgs) mutable {
+						return std::apply(
+								[&](auto &... definedArgs)
+								{
+									//the defined args are reused on every resolve, so they must never be moved from
+									if (auto target = DependencyTarget(*dependency, &self == owner))
+										return std::shared_ptr<TInterface>(self.ResolveBound<T, arg_t<TArgs> ..., arg_t<TRemainingArgs> ...>(
+												nullptr, *target, movable << sizeof...(TArgs), const_cast<arg_t<TArgs> &>(definedArgs) ..., remainingArgs ...));
+									return std::shared_ptr<TInterface>(self.ResolveImpl<T, arg_t<TArgs> ..., arg_t<TRemainingArgs> ...>(
+											nullptr, movable << sizeof...(TArgs), const_cast<arg_t<TArgs> &>(definedArgs) ..., remainingArgs ...));
+								}, args);
+					}), type_key<T>});
+			binding.dependencies.emplace_back(std::move(dependency));
+			binding.links.store(table.get(), std::memory_order_release);
+			retained_.emplace_back(std::move(table));
+			++root.linkCount;
+		}
+//endregion
+//region Resolveing
+//region Resolve
+		/// Resolves T with arguments in their canonical form (see factory_t)
+		/// \tparam T The type to resolve
+		/// \tparam TArgs The plain types of the arguments
+		/// \param failure Receives why T could not be found instead of throwing, if not nullptr; failures of the factories are thrown regardless
+		/// \param movable Bitmask of the arguments that may be moved from
+		/// \param args The arguments that will be used when resolving
+		/// \return The resolved instance or nullptr if failure has been set
+		template <class T, typename ... TArgs>
+		std::shared_ptr<T> ResolveImpl(ResolveFailure *failure, unsigned movable, TArgs &... args)
+		{
+			auto binding = FindBinding(type_key<T, TArgs ...>, type_key<T>);
+			if(!binding)
+				return ResolveUnbound<T>(failure);
+			return ResolveBound<T>(failure, *binding, movable, args ...);
+		}
+
+		/// Resolves T through its binding for the argument signature TArgs
+		template <class T, typename ... TArgs>
+		std::shared_ptr<T> ResolveBound(ResolveFailure *failure, Binding &binding, unsigned movable, TArgs &... args)
+		{
+			switch(binding.scope){
+				case Scope::Singleton: {
+					resolve_record record(*binding.root);
+					if(auto instance = binding.root->instance.load(std::memory_order_acquire)){
+						RecordInstanceHit(*binding.root);
+						return std::static_pointer_cast<T>(*instance);
+					}
+					auto factory = static_cast<const factory_t<T, TArgs...> *>(binding.factory.load(std::memory_order_acquire));
+					if(!factory){
+						Fail<T>(failure, ResolveError::NoFactory, "Singleton ", binding.root->factoryCount ? " has no factory with the supplied arguments" : " has neither an instance nor a factory");
+						return nullptr;
+					}
+					//a singleton inherited from a parent is constructed by the parent, which shares it with all of its children
+					return std::static_pointer_cast<T>(ConstructInstance<T>(*binding.owner, *binding.root, *factory, movable, args ...));
+				}
+				case Scope::Transient: {
+					resolve_record record(*binding.root);
+					auto factory = static_cast<const factory_t<T, TArgs...> *>(binding.factory.load(std::memory_order_acquire));
+					if(!factory){
+						Fail<T>(failure, ResolveError::NoFactory, "Type ", binding.root->factoryCount ? " has no factory method with the supplied arguments" : " has no registered factory methods");
+						return nullptr;
+					}
+					return CallFactory<T>(*this, *binding.root, *factory, movable, args ...);
+				}
+				case Scope::Interface:
+					return ResolveLink<T>(failure, binding, RuntimeId(), movable, args ...);
+				case Scope::Scoped: {
+					resolve_record record(*binding.root);
+					auto factory = static_cast<const factory_t<T, TArgs...> *>(binding.factory.load(std::memory_order_acquire));
+					if(!factory){
+						Fail<T>(failure, ResolveError::NoFactory, "Scoped type ", binding.root->factoryCount ? " has no factory method with the supplied arguments" : " has no registered factory methods");
+						return nullptr;
+					}
+					return ResolveScoped<T>(failure, binding, *factory, movable, args ...);
+				}
+				default:
+					Fail<T>(failure, ResolveError::InvalidScope, "Type ", " is registered with an invalid Scope");
+					return nullptr;
+			}
+		}
+
+		/// Handles resolving T with an argument signature nothing has been registered for
+		/// \return The singleton instance of T if it has one
+		template <class T>
+		std::shared_ptr<T> ResolveUnbound(ResolveFailure *failure)
+		{
+			auto root = FindRoot(type_key<T>);
+			if(!root){
+				Fail<T>(failure, ResolveError::NotRegistered, "Type ", " is not registered");
+				return nullptr;
+			}
+
+			switch(root->scope){
+				case Scope::Singleton:
+					if(auto instance = root->instance.load(std::memory_order_acquire)) return std::static_pointer_cast<T>(*instance);
+					Fail<T>(failure, ResolveError::NoFactory, "Singleton ", root->factoryCount ? " has no factory with the supplied arguments" : " has neither an instance nor a factory");
+					break;
+				case Scope::Transient:
+					Fail<T>(failure, ResolveError::NoFactory, "Type ", root->factoryCount ? " has no factory method with the supplied arguments" : " has no registered factory methods");
+					break;
+				case Scope::Interface:
+					Fail<T>(failure, ResolveError::NoLink, "Interface ", root->linkCount ? " has no link with the supplied arguments" : " has no associated, linked types");
+					break;
+				case Scope::Scoped:
+					Fail<T>(failure, ResolveError::NoFactory, "Scoped type ", root->factoryCount ? " has no factory method with the supplied arguments" : " has no registered factory methods");
+					break;
+				default:
+					Fail<T>(failure, ResolveError::InvalidScope, "Type ", " is registered with an invalid Scope");
+			}
+			return nullptr;
+		}
+
+		/// Returns the instance of T in the current ResolutionScope, creating it with factory if there is none yet
+		template <class T, typename ... TArgs>
+		std::shared_ptr<T> ResolveScoped(ResolveFailure *failure, Binding &binding, const factory_t<T, TArgs...> &factory, unsigned movable, TArgs &... args)
+		{
+			auto scope = ResolutionScope::current_;
+			if(!scope || scope->container_.get() != this){
+				Fail<T>(failure, ResolveError::NoResolutionScope, "Scoped type ", " can only be resolved through a ResolutionScope of this container");
+				return nullptr;
+			}
+			if(auto instance = scope->Find(binding.root)){
+				RecordInstanceHit(*binding.root);
+				return std::static_pointer_cast<T>(*instance);
+			}
+			auto instance = CallFactory<T>(*this, *binding.root, factory, movable, args ...);
+			scope->instances_.emplace_back(binding.root, instance);
+			return instance;
+		}
+
+		/// The memory resource Allocator supplies on this thread
+		/// \param root Root binding of the type that is created or nullptr
+		std::pmr::memory_resource *CurrentResource(const Binding *root) const noexcept
+		{
+			if(root){
+				if(auto resource = root->resource.load(std::memory_order_acquire))
+					return resource;
+				if(currentBatch_.root == root){
+					currentBatch_.used = true;
+					return currentBatch_.resource;
+				}
+			}
+			auto scope = ResolutionScope::current_;
+			if(scope && scope->container_.get() == this)
+				return &scope->arena_;
+			if(auto resource = resource_.load(std::memory_order_acquire))
+				return resource;
+			return std::pmr::get_default_resource();
+		}
+//endregion
+//region ResolveInterface
+		/// Resolves the link with the given id of a binding
+		/// \tparam TId RuntimeId or anything convertible to std::string_view
+		template <class T, typename TId, typename ... TArgs>
+		std::shared_ptr<T> ResolveLink(ResolveFailure *failure, Binding &binding, const TId &id, unsigned movable, TArgs &... args){
+			resolve_record record(*binding.root);
+			auto table = binding.links.load(std::memory_order_acquire);
+			if(table){
+				auto links = table->find([&]() -> decltype(auto) {
+					if constexpr (std::is_same_v<TId, RuntimeId>)
+						return id;
+					else
+						return std::string_view(id);
+				}());
+				if(links != table->end() && !links->second.empty())
+					return (*std::static_pointer_cast<factory_t<T, TArgs...>>(links->second.front().factory))(*this, movable, args ...);
+			}
+			Fail<T>(failure, ResolveError::NoLink, "Interface ", table ? " has no link with the supplied id" : " has no link with the supplied arguments");
+			return nullptr;
+		}
+
+		template <class T, typename ... TArgs, typename TId>
+		std::shared_ptr<T> ResolveInterfaceImpl(ResolveFailure *failure, const TId &id, unsigned movable, TArgs &... args){
+			auto binding = FindBinding(type_key<T, TArgs ...>, type_key<T>);
+			if(!binding || binding->scope != Scope::Interface){
+				auto root = FindRoot(type_key<T>);
+				Fail<T>(failure, ResolveError::NoLink, "Interface ", root && root->linkCount ? " has no link with the supplied arguments" : " has no associated, linked types");
+				return nullptr;
+			}
+			return ResolveLink<T>(failure, *binding, id, movable, args ...);
+		}
+
+		template <class T, typename TId, typename ... TArgs>
+		std::shared_ptr<T> ResolveInterfaceRuntimeId(const TId &id, TArgs &&... args){
+			return ResolveInterfaceImpl<T, arg_t<TArgs> ...>(nullptr, id, movable_mask<TArgs...>(), const_cast<arg_t<TArgs> &>(args) ...);
+		}
+		template <class T, FixedString id = "", typename ... TArgs>
+		std::shared_ptr<T> ResolveInterface(TArgs &&... args){
+			return ResolveInterfaceImpl<T, arg_t<TArgs> ...>(nullptr, interned_id<id>, movable_mask<TArgs...>(), const_cast<arg_t<TArgs> &>(args) ...);
+		}
+//endregion
+//region All
+		/// Shared, immutable result of ResolveAll
+		template <class T>
+		using all_t = std::shared_ptr<const std::vector<std::shared_ptr<T>>>;
+
+		/// Root binding of T, which has to be an interface with links
+		/// \return The root binding or nullptr if failure has been set
+		template <class T>
+		Binding *InterfaceRoot(ResolveFailure *failure = nullptr)
+		{
+			auto root = FindRoot(type_key<T>);
+			if(!root)
+				Fail<T>(failure, ResolveError::NotRegistered, "Type ", " is not registered");
+			else if(root->scope != Scope::Interface)
+				Fail<T>(failure, ResolveError::NotAnInterface, "Type ", " is not registered as an Interface");
+			else if(!root->linkCount)
+				Fail<T>(failure, ResolveError::NoLink, "Interface ", " has no associated, linked types");
+			else
+				return root;
+			return nullptr;
+		}
+
+		/// Resolves all available (parameterless) linked implementations of T (which has to be an interface)
+		/// \tparam T The Interface to resolve
+		/// \param failure Receives why T could not be found instead of throwing, if not nullptr
+		/// \return All linked implementations of T or nullptr if failure has been set
+		template <class T>
+		all_t<T> ResolveAll(ResolveFailure *failure = nullptr)
+		{
+			auto root = InterfaceRoot<T>(failure);
+			return root ? ResolveAllBound<T>(*root) : nullptr;
+		}
+
+		/// The snapshot cached on root if it has been resolved from table, otherwise nullptr
+		template <class T>
+		static std::shared_ptr<const all_snapshot<T>> CachedAll(const Binding &root, const link_table *table)
+		{
+			auto cached = std::static_pointer_cast<const all_snapshot<T>>(root.all.load(std::memory_order_acquire));
+			return cached && cached->table == table ? cached : nullptr;
+		}
+
+		/// Whether all links of table point to Singletons, so their instances never change
+		bool Cacheable(const link_table &table) const
+		{
+			for (const auto &id_vector : table)
+			{
+				for (const auto &link : id_vector.second)
+				{
+					auto target = FindRoot(link.target);
+					if (!target || target->scope != Scope::Singleton)
+						return false;
+				}
+			}
+			return true;
 		}
 
-		/// Needed for dependency matching; see <b>AddFactoryImpl</b>
-		/// \tparam T Type that the factory creates
-		/// \tparam TArgs All arguments of the supplied factory
-		/// \param pFactory Factory method
-		template <class T, typename... TArgs>
-		void AddFactory(std::function<std::shared_ptr<T>(TArgs ...)> && pFactory)
+		/// \brief Resolves all parameterless linked implementations through the root binding of T
+		/// \details The result is cached on root while it stays valid (see all_snapshot), so it is only resolved again after a link has been added.
+		/// A child container neither uses nor fills the cache of an interface inherited from its parent, since it may override the linked types.
+		template <class T>
+		all_t<T> ResolveAllBound(Binding &root)
 		{
-			return AddFactoryImpl<T>(register_traits<TArgs...>{}, std::forward<std::function<std::shared_ptr<T> (TArgs...)>>(pFactory));
+			resolve_record record(root);
+			auto table = root.links.load(std::memory_order_acquire);
+			auto owned = root.owner == this;
+			if (auto cached = owned ? CachedAll<T>(root, table) : nullptr) {
+				RecordInstanceHit(root);
+				return all_t<T>(cached, &cached->instances);
+			}
+			auto snapshot = std::make_shared<all_snapshot<T>>(table);
+			if(table){
+				for (const auto& id_vector : *table)
+				{
+					for(const auto &link : id_vector.second)
+						snapshot->instances.emplace_back((*std::static_pointer_cast<factory_t<T>>(link.factory))(*this, 0u));
+				}
+			}
+			if (owned && (!table || Cacheable(*table)))
+				root.all.store(snapshot, std::memory_order_release);
+			return all_t<T>(snapshot, &snapshot->instances);
 		}
 //endregion
-//region AddLink
-		/// Adds a link between TInterface and T
-		/// \tparam T The type to link to
-		/// \tparam TInterface The Interface to link
-		/// \tparam TArgs Arguments that should be supplied when resolving
-		template <class TInterface, class T, FixedString id, typename ... TRemainingArgs, typename ... TArgs>
-		void AddLink(TArgs &&... args) {
-			registeredLinks_[typeid(TInterface)][std::vector<std::type_index>{typeid(TRemainingArgs) ...}][id].insert(registeredLinks_[typeid(TInterface)][std::vector<std::type_index>{typeid(TRemainingArgs) ...}][id].cbegin(), std::make_shared<std::function<std::shared_ptr<TInterface>(TRemainingArgs &&...)>>(
-					[self_weak = weak_from_this(), args = std::tuple<TArgs ...>(std::forward<TArgs>(args) ...)](TRemainingArgs &&... remainingArgs){
-						return std::apply(
-								[self_weak](TArgs &&...args, TRemainingArgs &&...remainingArgs)
-								{
-									if (auto self = self_weak.lock())
-										return std::dynamic_pointer_cast<TInterface>(self->Resolve<T>(std::forward<TArgs>(args) ..., std::forward<TRemainingArgs>(remainingArgs)...));
-									throw ContainerException("Container is expired");
-								}, std::tuple_cat(args, std::tuple<TRemainingArgs ...>(std::forward<TRemainingArgs>(remainingArgs) ...)));
-					}));
-		}
+//endregion
+//region WarmUp
+		/// What WarmUp knows about a singleton it constructs
+		struct warm_up_node{
+			explicit warm_up_node(Binding &root_) : root(root_) {}
+			Binding &root;
+			/// Indices of the nodes that depend on this one
+			std::vector<std::size_t> dependents;
+			/// Number of nodes this one depends on that have not been constructed yet
+			std::atomic<std::size_t> pending{0};
+			std::atomic<bool> started{false};
+		};
 
-		/// Adds a link between TInterface and T
-		/// \tparam T The type to link to
-		/// \tparam TInterface The Interface to link
-		/// \tparam TArgs Arguments that should be supplied when resolving
-		template <class TInterface, class T, typename ... TRemainingArgs, typename ... TArgs>
-		void AddLinkRuntimeId(const std::string& id, TArgs &&... args) {
-			registeredLinks_[typeid(TInterface)][std::vector<std::type_index>{typeid(TRemainingArgs) ...}][id].insert(registeredLinks_[typeid(TInterface)][std::vector<std::type_index>{typeid(TRemainingArgs) ...}][id].cbegin(), std::make_shared<std::function<std::shared_ptr<TInterface>(TRemainingArgs &&...)>>(
-					[self_weak = weak_from_this(), args = std::tuple<TArgs ...>(std::forward<TArgs>(args) ...)](TRemainingArgs &&... remainingArgs){
-						return std::apply(
-								[self_weak](TArgs &&...args, TRemainingArgs &&...remainingArgs)
-								{
-									if (auto self = self_weak.lock())
-										return std::dynamic_pointer_cast<TInterface>(self->Resolve<T>(std::forward<TArgs>(args) ..., std::forward<TRemainingArgs>(remainingArgs)...));
-									throw ContainerException("Container is expired");
-								}, std::tuple_cat(args, std::tuple<TRemainingArgs ...>(std::forward<TRemainingArgs>(remainingArgs) ...)));
-					}));
+		/// Shared by WarmUp and the tasks it schedules
+		struct warm_up_state{
+			explicit warm_up_state(Container &container_) : container(container_) {}
+			/// Outlives the warm up, which waits for all nodes
+			Container &container;
+			std::vector<std::unique_ptr<warm_up_node>> nodes;
+			std::function<void(std::function<void()>)> executor;
+			std::mutex mutex;
+			std::condition_variable idle;
+			/// Number of scheduled nodes that have not finished yet
+			std::size_t running = 0;
+			WarmUpReport report;
+		};
+
+		/// Adds the root bindings of the singletons that get resolved when dependency is resolved, looking through all other bindings
+		void CollectSingletons(const DependencyInfo &dependency, std::vector<const Binding *> &visited, std::vector<Binding *> &singletons) const
+		{
+			if (dependency.deferred || dependency.kind == DependencyKind::Allocator)
+				return;
+			auto root = FindRoot(dependency.root);
+			if (!root)
+				return;
+			if (root->scope == Scope::Singleton){
+				singletons.push_back(root);
+				return;
+			}
+			//injected interfaces resolve through the links of the root binding - all of them are considered, regardless of the id
+			auto binding = dependency.kind == DependencyKind::Resolve ? root->owner->bindings_.Find(dependency.signature) : root;
+			if (!binding || std::find(visited.begin(), visited.end(), binding) != visited.end())
+				return;
+			visited.push_back(binding);
+			for (const auto &next : binding->dependencies)
+				CollectSingletons(*next, visited, singletons);
 		}
-//endregion
-//region Resolveing
-//region ResolveInterface
-		template <class T, typename ... TArgs>
-		std::shared_ptr<T> ResolveInterfaceRuntimeId(std::string id, TArgs &&... args){ // NOLINT(performance-unnecessary-value-param)
-			if(!container_contains(registeredLinks_, typeid(T)) || registeredLinks_[typeid(T)].empty()){
-				auto ss = std::ostringstream();
-				ss << "Interface " << boost::typeindex::type_id<T>().pretty_name() << " has no associated, linked types";
-				throw ContainerException(ss.str());
+
+		/// Constructs a node and schedules the nodes that only waited for it
+		static void RunWarmUpNode(const std::shared_ptr<warm_up_state> &state, std::size_t index)
+		{
+			auto &node = *state->nodes[index];
+			auto begin = std::chrono::steady_clock::now();
+			std::exception_ptr error;
+			try{
+				node.root.construct(state->container, node.root);
 			}
-			if(!container_contains(registeredLinks_[typeid(T)], std::vector<std::type_index>{typeid(TArgs) ...}) || registeredLinks_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}].empty()){
-				auto ss = std::ostringstream();
-				ss << "Interface " << boost::typeindex::type_id<T>().pretty_name() << " has no link with the supplied arguments";
-				throw ContainerException(ss.str());
+			catch (...){
+				error = std::current_exception();
 			}
-			if(!container_contains(registeredLinks_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}], id)){
-				auto ss = std::ostringstream();
-				ss << "Interface " << boost::typeindex::type_id<T>().pretty_name() << " has no link with the supplied id";
-				throw ContainerException(ss.str());
+			auto duration = std::chrono::steady_clock::now() - begin;
+			{
+				std::lock_guard lock(state->mutex);
+				state->report.entries.push_back({node.root.name(), duration, error});
 			}
-			return (*std::static_pointer_cast<std::function<std::shared_ptr<T>(TArgs...)>>(registeredLinks_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}][id].front()))(std::forward<TArgs>(args) ...);
+
+			for (auto dependent : node.dependents)
+				if (state->nodes[dependent]->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					ScheduleWarmUpNode(state, dependent);
+
+			std::lock_guard lock(state->mutex);
+			if (--state->running == 0)
+				state->idle.notify_all();
 		}
-		template <class T, FixedString id = "", typename ... TArgs>
-		std::shared_ptr<T> ResolveInterface(TArgs &&... args){
-			if(!container_contains(registeredLinks_, typeid(T)) || registeredLinks_[typeid(T)].empty()){
-				auto ss = std::ostringstream();
-				ss << "Interface " << boost::typeindex::type_id<T>().pretty_name() << " has no associated, linked types";
-				throw ContainerException(ss.str());
+
+		/// Hands a node to the executor unless it has been already
+		static void ScheduleWarmUpNode(const std::shared_ptr<warm_up_state> &state, std::size_t index)
+		{
+			if (state->nodes[index]->started.exchange(true, std::memory_order_relaxed))
+				return;
+			{
+				std::lock_guard lock(state->mutex);
+				++state->running;
 			}
-			if(!container_contains(registeredLinks_[typeid(T)], std::vector<std::type_index>{typeid(TArgs) ...}) || registeredLinks_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}].empty()){
-				auto ss = std::ostringstream();
-				ss << "Interface " << boost::typeindex::type_id<T>().pretty_name() << " has no link with the supplied arguments";
-				throw ContainerException(ss.str());
+			try{
+				state->executor([state, index](){ RunWarmUpNode(state, index); });
 			}
-			if(!container_contains(registeredLinks_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}], id)){
-				auto ss = std::ostringstream();
-				ss << "Interface " << boost::typeindex::type_id<T>().pretty_name() << " has no link with the supplied id";
-				throw ContainerException(ss.str());
+			catch (...){
+				//the executor refused the task, so it is run right here
+				RunWarmUpNode(state, index);
 			}
-			return (*std::static_pointer_cast<std::function<std::shared_ptr<T>(TArgs...)>>(registeredLinks_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}][id].front()))(std::forward<TArgs>(args) ...);
 		}
-//endregion
-//region All
-		/// Resolves all available (parameterless) linked implementations of T (which has to be an interface)
-		/// \tparam T The Interface to resolve
-		/// \return All linked implementations of T
-		template <class T>
-		std::vector<std::shared_ptr<T>> ResolveAll()
+
+		/// See WarmUp
+		WarmUpReport WarmUpImpl(std::function<void(std::function<void()>)> executor)
 		{
-			if(!container_contains(registeredTypes_, typeid(T))){
-				auto ss = std::ostringstream();
-				ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " is not registered";
-				throw ContainerException(ss.str());
-			}
-			if(registeredTypes_[typeid(T)] != Scope::Interface) {
-				auto ss = std::ostringstream();
-				ss << "Type " << boost::typeindex::type_id<T>().pretty_name()<< " is not registered as an Interface";
-				throw ContainerException(ss.str());
-			}
-			if(!container_contains(registeredLinks_, typeid(T)) || registeredLinks_[typeid(T)].empty()){
-				auto ss = std::ostringstream();
-				ss << "Interface " << boost::typeindex::type_id<T>().pretty_name() << " has no associated, linked types";
-				throw ContainerException(ss.str());
+			auto begin = std::chrono::steady_clock::now();
+			auto state = std::make_shared<warm_up_state>(*this);
+			state->executor = std::move(executor);
+			auto &nodes = state->nodes;
+			{
+				std::lock_guard lock(registrationMutex_);
+				auto indices = std::unordered_map<const Binding *, std::size_t>();
+				bindings_.ForEach([&](Binding &binding){
+					if (binding.root == &binding && binding.construct && !binding.instance.load(std::memory_order_acquire)){
+						indices.emplace(&binding, nodes.size());
+						nodes.emplace_back(std::make_unique<warm_up_node>(binding));
+					}
+				});
+				for (std::size_t i = 0; i < nodes.size(); ++i){
+					auto visited = std::vector<const Binding *>{&nodes[i]->root};
+					auto singletons = std::vector<Binding *>();
+					for (const auto &dependency : nodes[i]->root.dependencies)
+						CollectSingletons(*dependency, visited, singletons);
+					std::sort(singletons.begin(), singletons.end());
+					singletons.erase(std::unique(singletons.begin(), singletons.end()), singletons.end());
+					for (auto singleton : singletons){
+						auto dependency = indices.find(singleton);
+						if (dependency == indices.end() || dependency->second == i)
+							continue;
+						nodes[dependency->second]->dependents.push_back(i);
+						nodes[i]->pending.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
 			}
 
-			auto res = std::vector<std::shared_ptr<T>>();
-			for (const auto& id_vector : registeredLinks_[typeid(T)][std::vector<std::type_index>()])
+			for (std::size_t i = 0; i < nodes.size(); ++i)
+				if (nodes[i]->pending.load(std::memory_order_relaxed) == 0)
+					ScheduleWarmUpNode(state, i);
 			{
-				for(auto link : id_vector.second)
-					res.insert(res.end(), (*std::static_pointer_cast<std::function<std::shared_ptr<T>()>>(link))());
+				std::unique_lock lock(state->mutex);
+				state->idle.wait(lock, [&](){ return state->running == 0; });
 			}
-			return res;
+
+			//whatever is left depends on a cycle; constructing it in order reports the cycle
+			state->executor = [](const std::function<void()> &task){ task(); };
+			for (std::size_t i = 0; i < nodes.size(); ++i)
+				ScheduleWarmUpNode(state, i);
+
+			state->report.total = std::chrono::steady_clock::now() - begin;
+			return std::move(state->report);
+		}
+//endregion
+//region Async
+		/// \brief Starts constructing the singleton instance of root on a thread of its own, unless its construction has been started already
+		/// \details Before calling the factory, the thread starts the constructions of the singletons T depends on, so they run concurrently.
+		/// If the construction fails, the next call starts it again.
+		/// \param container The container root has been registered in
+		/// \return The construction
+		template <class T>
+		static std::shared_future<std::shared_ptr<T>> StartConstruction(Container &container, Binding &root)
+		{
+			std::lock_guard lock(container.asyncMutex_);
+			if (root.pending)
+				return *std::static_pointer_cast<std::shared_future<std::shared_ptr<T>>>(root.pending);
+			auto promise = std::make_shared<std::promise<std::shared_ptr<T>>>();
+			auto future = std::make_shared<std::shared_future<std::shared_ptr<T>>>(promise->get_future().share());
+			root.pending = future;
+			//the thread keeps the container alive until it is done
+			std::thread([self = container.shared_from_this(), &root, promise](){
+				try{
+					auto starts = std::vector<std::pair<Binding *, void (*)(Container &, Binding &)>>();
+					{
+						std::lock_guard registrationLock(self->registrationMutex_);
+						auto visited = std::vector<const Binding *>{&root};
+						auto singletons = std::vector<Binding *>();
+						for (const auto &dependency : root.dependencies)
+							self->CollectSingletons(*dependency, visited, singletons);
+						for (auto singleton : singletons){
+							//a singleton depending back on T is left to this thread, where constructing it reports the cycle instead of deadlocking
+							auto checked = std::vector<const Binding *>{singleton};
+							if (singleton->constructAsync && !self->DependsOn(*singleton, root, checked))
+								starts.emplace_back(singleton, singleton->constructAsync);
+						}
+					}
+					for (auto [singleton, constructAsync] : starts)
+						if (!singleton->instance.load(std::memory_order_acquire))
+							constructAsync(*singleton->owner, *singleton);
+					promise->set_value(self->ResolveBound<T>(nullptr, root, 0u));
+				}
+				catch (...){
+					{
+						std::lock_guard asyncLock(self->asyncMutex_);
+						root.pending.reset();
+					}
+					promise->set_exception(std::current_exception());
+				}
+			}).detach();
+			return *future;
+		}
+
+		/// Whether constructing the singleton of from resolves the singleton of target, directly or through other singletons
+		/// \param visited Singletons that have been checked already
+		bool DependsOn(const Binding &from, const Binding &target, std::vector<const Binding *> &visited) const
+		{
+			auto bindings = std::vector<const Binding *>{&from};
+			auto singletons = std::vector<Binding *>();
+			for (const auto &dependency : from.dependencies)
+				CollectSingletons(*dependency, bindings, singletons);
+			for (auto singleton : singletons){
+				if (singleton == &target)
+					return true;
+				if (std::find(visited.begin(), visited.end(), singleton) != visited.end())
+					continue;
+				visited.push_back(singleton);
+				if (DependsOn(*singleton, target, visited))
+					return true;
+			}
+			return false;
+		}
+
+		/// Binding::constructAsync of a Singleton T
+		template <class T>
+		static void ConstructSingletonAsync(Container &container, Binding &root)
+		{
+			StartConstruction<T>(container, root);
 		}
 //endregion
+//region Freeze
+		/// Whether binding has a link with the given id
+		static bool HasLink(const Binding &binding, std::string_view id)
+		{
+			auto table = binding.links.load(std::memory_order_acquire);
+			if (!table)
+				return false;
+			auto links = table->find(id);
+			return links != table->end() && !links->second.empty();
+		}
+
+		/// Checks whether a dependency can be resolved, without constructing anything
+		/// \param dependency The dependency to check
+		/// \param target Set to the binding the dependency can be resolved through, if there is one
+		/// \return A description of the problem or an empty string if the dependency can be resolved
+		std::string CheckDependency(const DependencyInfo &dependency, Binding *&target) const
+		{
+			target = nullptr;
+			if (dependency.kind == DependencyKind::Allocator)
+				return {};
+			auto root = FindRoot(dependency.root);
+			if (!root)
+				return "Type " + dependency.name() + " is not registered";
+
+			switch (dependency.kind){
+				case DependencyKind::Resolve: {
+					auto binding = root->owner->bindings_.Find(dependency.signature);
+					switch (root->scope){
+						case Scope::Singleton:
+							if (binding && binding->factory.load(std::memory_order_acquire))
+								target = binding;
+							else if (!root->instance.load(std::memory_order_acquire))
+								return "Singleton " + dependency.name() + " has no factory with the required arguments";
+							return {};
+						case Scope::Transient:
+							if (!binding || !binding->factory.load(std::memory_order_acquire))
+								return "Type " + dependency.name() + " has no factory method with the required arguments";
+							target = binding;
+							return {};
+						case Scope::Scoped:
+							if (!binding || !binding->factory.load(std::memory_order_acquire))
+								return "Scoped type " + dependency.name() + " has no factory method with the required arguments";
+							target = binding;
+							return {};
+						case Scope::Interface:
+							if (!binding || !HasLink(*binding, ""))
+								return "Interface " + dependency.name() + " has no link with the required arguments";
+							target = binding;
+							return {};
+					}
+					break;
+				}
+				case DependencyKind::Interface:
+					if (!HasLink(*root, dependency.id))
+						return "Interface " + dependency.name() + " has no link with the id \"" + dependency.id + "\"";
+					target = root;
+					return {};
+				case DependencyKind::InterfaceRuntimeId:
+					if (!root->links.load(std::memory_order_acquire))
+						return "Interface " + dependency.name() + " has no links without arguments";
+					target = root;
+					return {};
+				case DependencyKind::All:
+					if (root->scope != Scope::Interface || !root->linkCount)
+						return "Interface " + dependency.name() + " has no associated, linked types";
+					target = root;
+					return {};
+				case DependencyKind::Allocator:
+					return {};
+			}
+			return "Type " + dependency.name() + " is registered with an invalid Scope";
+		}
 //endregion
 //endregion
 //region public
@@ -306,6 +1897,28 @@ namespace mabiphmo::ioc_container{
 //region Construction
         /// Default constructor
         Container() = default;
+		/// Constructs a child of parent, see CreateChild
+		Container(child_tag, std::shared_ptr<Container> parent) : parent_(std::move(parent)) {}
+
+		/// \brief Creates a container that inherits the registrations and singleton instances of this one
+		/// \details The child starts out empty and shares this container's registrations instead of copying them, so creating it costs a single allocation
+		/// no matter how much has been registered; registrations added to this container later are inherited as well. A type registered in the child
+		/// overrides all of this container's registrations of that type (factories, instance and links) for the child and its own children;
+		/// nothing registered in the child is visible to this container.
+		/// Inherited Singletons are constructed by this container - their dependencies are resolved here - and shared with all children.
+		/// Inherited Transient, Scoped and Interface types resolve their dependencies and linked types through the child, so they pick up its overrides.
+		/// The child can be frozen independently of this container. It keeps this container alive.
+		/// \return The child container
+		std::shared_ptr<Container> CreateChild()
+		{
+			return std::make_shared<Container>(child_tag(), shared_from_this());
+		}
+
+		/// The container this one has been created by through CreateChild or nullptr
+		[[nodiscard]] const std::shared_ptr<Container> &Parent() const noexcept
+		{
+			return parent_;
+		}
 //endregion
 //region Registering
 //region T::Register
@@ -326,87 +1939,133 @@ namespace mabiphmo::ioc_container{
 		template <class T>
 		void RegisterSingleton(std::shared_ptr<T> pInstance)
 		{
+			std::lock_guard lock(registrationMutex_);
+			EnsureNotFrozen<T>();
 			//check whether the type is registered
-			if (!container_contains(registeredTypes_, typeid(T))) {
-				//mark the type as registered as singleton
-				registeredTypes_[typeid(T)] = Scope::Singleton;
-				//add the instance
-				registeredInstances_[typeid(T)] = pInstance;
+			auto root = bindings_.Find(type_key<T>);
+			if (!root) {
+				//mark the type as registered as singleton and add the instance
+				PublishInstance(AddRoot<T>(Scope::Singleton), std::move(pInstance));
 				return;
 			}
 
 			//assertions for a registered type
-			if (registeredTypes_[typeid(T)] != Scope::Singleton){
+			if (root->scope != Scope::Singleton){
 				auto ss = std::ostringstream();
-				ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " is already registered as non - Singleton";
+				ss << "Type " << pretty_name<T>() << " is already registered as non - Singleton";
 				throw ContainerException(ss.str());
 			}
-			if (container_contains(registeredInstances_, typeid(T))){
+			//add the instance
+			if (root->instance.load(std::memory_order_acquire) || PublishInstance(*root, pInstance) != pInstance){
 				auto ss = std::ostringstream();
-				ss << "Singleton " << boost::typeindex::type_id<T>().pretty_name() << " already has a registered instance";
+				ss << "Singleton " << pretty_name<T>() << " already has a registered instance";
 				throw ContainerException(ss.str());
 			}
-
-			//add the instance
-			registeredInstances_[typeid(T)] = pInstance;
 		}
 //endregion
 //region Factory
 		/// @brief Registers a type as Singleton with a factory
 		/// @details The factory will only be called once - after that resolving won't be dependent on the arguments anymore and the singleton instance will be returned
-		/// \tparam T Type to register
-		/// \tparam TArgs Arguments the factory takes (dependencies will be resolved according to these args)
+		/// \tparam F Type of the factory - a std::function or any other callable with a single signature that returns std::shared_ptr<T> for the type T to register
+		/// (dependencies will be resolved according to its parameters)
 		/// \param pFactory Factory method
-		template <class T, typename... TArgs>
-		void RegisterSingleton(std::function<std::shared_ptr<T>(TArgs ...)> && pFactory)
+		template <typename F> requires requires { typename factory_traits<F>::type; }
+		void RegisterSingleton(F && pFactory)
 		{
+			using T = typename factory_traits<F>::type;
+			std::lock_guard lock(registrationMutex_);
+			EnsureNotFrozen<T>();
 			//check whether the type is registered
-			if (!container_contains(registeredTypes_, typeid(T))) {
-				//mark the type as registered as singleton
-				registeredTypes_[typeid(T)] = Scope::Singleton;
-				//add the factory
-				AddFactory<T>(std::forward<std::function<std::shared_ptr<T>(TArgs ...)>>(pFactory));
+			auto root = bindings_.Find(type_key<T>);
+			if (!root) {
+				//mark the type as registered as singleton and add the factory
+				AddFactory(AddRoot<T>(Scope::Singleton), std::forward<F>(pFactory));
 				return;
 			}
 
 			//assertions for a registered type
-			if (registeredTypes_[typeid(T)] != Scope::Singleton){
+			if (root->scope != Scope::Singleton){
 				auto ss = std::ostringstream();
-				ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " is already registered as non - Singleton";
+				ss << "Type " << pretty_name<T>() << " is already registered as non - Singleton";
 				throw ContainerException(ss.str());
 			}
 
 			//add the factory
-			AddFactory<T>(std::forward<std::function<std::shared_ptr<T>(TArgs ...)>>(pFactory));
+			AddFactory(*root, std::forward<F>(pFactory));
+		}
+//endregion
+//region Async
+		/// \brief Registers a type as Singleton with a factory that produces the instance asynchronously
+		/// \details The factory returns a std::future or std::shared_future of std::shared_ptr<T>, e.g. of a std::async loading a file.
+		/// Its parameters are matched like those of RegisterSingleton. Resolving T waits for the future; ResolveAsync does not block the caller
+		/// and overlaps the constructions of singletons that do not depend on each other.
+		/// \tparam F Type of the factory - a std::function or any other callable with a single signature
+		/// \param pFactory Factory method
+		template <typename F> requires requires { typename async_factory_traits<F>::type; }
+		void RegisterSingletonAsync(F && pFactory)
+		{
+			RegisterSingleton(async_factory_traits<F>::Wait(std::forward<F>(pFactory)));
 		}
 //endregion
 //endregion
 //region Transient
 		/// Registers a type as Transient (new instances will be created each time it is resolved) with a factory
-		/// \tparam T Type to register
-		/// \tparam TArgs Arguments the factory takes (dependencies will be resolved according to these args)
+		/// \tparam F Type of the factory - a std::function or any other callable with a single signature that returns std::shared_ptr<T> for the type T to register
+		/// (dependencies will be resolved according to its parameters)
 		/// \param pFactory Factory method
-		template <class T, typename... TArgs>
-		void RegisterTransient(std::function<std::shared_ptr<T>(TArgs ...)> && pFactory)
+		template <typename F> requires requires { typename factory_traits<F>::type; }
+		void RegisterTransient(F && pFactory)
+		{
+			using T = typename factory_traits<F>::type;
+			std::lock_guard lock(registrationMutex_);
+			EnsureNotFrozen<T>();
+			//check whether the type is registered
+			auto root = bindings_.Find(type_key<T>);
+			if (!root){
+				//mark the type as registered as factory and add the factory
+				AddFactory(AddRoot<T>(Scope::Transient), std::forward<F>(pFactory));
+				return;
+			}
+
+			//assertions for a registered type
+			if (root->scope != Scope::Transient){
+				auto ss = std::ostringstream();
+				ss << "Type " << pretty_name<T>() << " is already registered as non - Transient";
+				throw ContainerException(ss.str());
+			}
+
+			//add the factory
+			AddFactory(*root, std::forward<F>(pFactory));
+		}
+//endregion
+//region Scoped
+		/// Registers a type as Scoped (one instance per ResolutionScope) with a factory
+		/// \tparam F Type of the factory - a std::function or any other callable with a single signature that returns std::shared_ptr<T> for the type T to register
+		/// (dependencies will be resolved according to its parameters)
+		/// \param pFactory Factory method
+		template <typename F> requires requires { typename factory_traits<F>::type; }
+		void RegisterScoped(F && pFactory)
 		{
+			using T = typename factory_traits<F>::type;
+			std::lock_guard lock(registrationMutex_);
+			EnsureNotFrozen<T>();
 			//check whether the type is registered
-			if (!container_contains(registeredTypes_, typeid(T))){
-				//mark the type as registered as factory
-				registeredTypes_[typeid(T)] = Scope::Transient;
-				//add the factory
-				AddFactory<T>(std::forward<std::function<std::shared_ptr<T>(TArgs ...)>>(pFactory));
+			auto root = bindings_.Find(type_key<T>);
+			if (!root){
+				//mark the type as registered as scoped and add the factory
+				AddFactory(AddRoot<T>(Scope::Scoped), std::forward<F>(pFactory));
 				return;
 			}
 
 			//assertions for a registered type
-			if (registeredTypes_[typeid(T)] != Scope::Transient){
+			if (root->scope != Scope::Scoped){
 				auto ss = std::ostringstream();
-				ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " is already registered as non - Transient";
+				ss << "Type " << pretty_name<T>() << " is already registered as non - Scoped";
 				throw ContainerException(ss.str());
 			}
 
 			//add the factory
-			AddFactory<T>(std::forward<std::function<std::shared_ptr<T>(TArgs ...)>>(pFactory));
+			AddFactory(*root, std::forward<F>(pFactory));
 		}
 //endregion
 //region Interface
@@ -420,26 +2079,7 @@ namespace mabiphmo::ioc_container{
 		template <class TInterface, class T, FixedString id = "", typename ... TRemainingArgs, typename ... TArgs>
 		void RegisterOnInterface(TArgs &&... args)
 		{
-			static_assert(std::is_base_of<TInterface, T>::value, "T should be derived from the interface");
-
-			//check whether the type is registered
-			if (!container_contains(registeredTypes_, typeid(TInterface))){
-				//mark the type as registered as factory
-				registeredTypes_[typeid(TInterface)] = Scope::Interface;
-				//add the link
-				AddLink<TInterface, T, id, TRemainingArgs ...>(std::forward<TArgs>(args) ...);
-				return;
-			}
-
-			//assertions for a registered type
-			if (registeredTypes_[typeid(TInterface)] != Scope::Interface){
-				auto ss = std::ostringstream();
-				ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " is already registered as non - Interface";
-				throw ContainerException(ss.str());
-			}
-
-			//add the link
-			AddLink<TInterface, T, id, TRemainingArgs ...>(std::forward<TArgs>(args) ...);
+			RegisterOnInterfaceRuntimeId<TInterface, T, TRemainingArgs ...>(interned_id<id>, std::forward<TArgs>(args) ...);
 		}
 
 		/// Registers TInterface to be resolvable by resolving via T
@@ -450,28 +2090,37 @@ namespace mabiphmo::ioc_container{
 		/// \param id Id the interface will be resolvable as
 		/// \param args Args to be defined for the interface when resolving the instance
 		template <class TInterface, class T, typename ... TRemainingArgs, typename ... TArgs>
-		void RegisterOnInterfaceRuntimeId(std::string id, TArgs &&... args)
+		void RegisterOnInterfaceRuntimeId(std::string_view id, TArgs &&... args)
+		{
+			RegisterOnInterfaceRuntimeId<TInterface, T, TRemainingArgs ...>(RuntimeId(id), std::forward<TArgs>(args) ...);
+		}
+
+		/// Registers TInterface to be resolvable by resolving via T with an interned id, see RegisterOnInterfaceRuntimeId above
+		template <class TInterface, class T, typename ... TRemainingArgs, typename ... TArgs>
+		void RegisterOnInterfaceRuntimeId(const RuntimeId &id, TArgs &&... args)
 		{
-			static_assert(std::is_base_of<TInterface, T>::value, "T should be derived from the interface");
+			//links upcast statically, which requires TInterface to be a public and unambiguous base
+			static_assert(std::is_convertible<T *, TInterface *>::value, "T should be derived from the interface");
 
+			std::lock_guard lock(registrationMutex_);
+			EnsureNotFrozen<TInterface>();
 			//check whether the type is registered
-			if (!container_contains(registeredTypes_, typeid(TInterface))){
-				//mark the type as registered as factory
-				registeredTypes_[typeid(TInterface)] = Scope::Interface;
-				//add the link
-				AddLinkRuntimeId<TInterface, T, TRemainingArgs ...>(id, std::forward<TArgs>(args) ...);
+			auto root = bindings_.Find(type_key<TInterface>);
+			if (!root){
+				//mark the type as registered as interface and add the link
+				AddLink<TInterface, T, TRemainingArgs ...>(AddRoot<TInterface>(Scope::Interface), id, std::forward<TArgs>(args) ...);
 				return;
 			}
 
 			//assertions for a registered type
-			if (registeredTypes_[typeid(TInterface)] != Scope::Interface){
+			if (root->scope != Scope::Interface){
 				auto ss = std::ostringstream();
-				ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " is already registered as non - Interface";
+				ss << "Type " << pretty_name<T>() << " is already registered as non - Interface";
 				throw ContainerException(ss.str());
 			}
 
 			//add the link
-			AddLinkRuntimeId<TInterface, T, TRemainingArgs ...>(id, std::forward<TArgs>(args) ...);
+			AddLink<TInterface, T, TRemainingArgs ...>(*root, id, std::forward<TArgs>(args) ...);
 		}
 //endregion
 //endregion
@@ -487,48 +2136,357 @@ namespace mabiphmo::ioc_container{
 		{
 			if constexpr(std::is_same<T, Container>::value)
 				return shared_from_this();
-			else{
-				if(!container_contains(registeredTypes_, typeid(T))){
+			else
+				return ResolveImpl<T, arg_t<TArgs> ...>(nullptr, movable_mask<TArgs...>(), const_cast<arg_t<TArgs> &>(args) ...);
+		}
+
+		/// \brief Resolves the type T with the supplied arguments, reporting instead of throwing if T cannot be found
+		/// \details Failing to find T, a factory for the arguments or a link neither allocates nor demangles, which makes probing for optional types cheap.
+		/// Exceptions thrown while constructing T, including those of its dependencies, are passed on.
+		/// \tparam T The type to resolve
+		/// \tparam TArgs The type of the arguments that will be used when resolving
+		/// \param args The arguments that will be used when resolving
+		/// \return The resolved instance or the reason it could not be resolved
+		template <class T, typename ... TArgs>
+		ResolveResult<T> TryResolve(TArgs &&... args)
+		{
+			auto res = ResolveResult<T>();
+			if constexpr(std::is_same<T, Container>::value)
+				res.value_ = shared_from_this();
+			else
+				res.value_ = ResolveImpl<T, arg_t<TArgs> ...>(&res.failure_, movable_mask<TArgs...>(), const_cast<arg_t<TArgs> &>(args) ...);
+			return res;
+		}
+
+		/// Resolves the link of the interface T with the given id like TryResolve
+		template <class T, FixedString id = "", typename ... TArgs>
+		ResolveResult<T> TryResolveInterface(TArgs &&... args)
+		{
+			auto res = ResolveResult<T>();
+			res.value_ = ResolveInterfaceImpl<T, arg_t<TArgs> ...>(&res.failure_, interned_id<id>, movable_mask<TArgs...>(), const_cast<arg_t<TArgs> &>(args) ...);
+			return res;
+		}
+
+		/// \brief Resolves the link of the interface T with an id that is only known at runtime like TryResolve
+		/// \details id can be a RuntimeId, which is looked up without hashing it, or anything convertible to std::string_view
+		template <class T, typename TId, typename ... TArgs>
+		requires std::is_same_v<TId, RuntimeId> || std::is_convertible_v<const TId &, std::string_view>
+		ResolveResult<T> TryResolveInterfaceRuntimeId(const TId &id, TArgs &&... args)
+		{
+			auto res = ResolveResult<T>();
+			res.value_ = ResolveInterfaceImpl<T, arg_t<TArgs> ...>(&res.failure_, id, movable_mask<TArgs...>(), const_cast<arg_t<TArgs> &>(args) ...);
+			return res;
+		}
+
+		/// \brief Resolves the Singleton T without blocking the calling thread
+		/// \details If T has no instance yet, it is constructed on a thread of its own through its factory without arguments. That thread first starts
+		/// the constructions of the singletons T depends on (Dependency, Injection, MultipleInjection, the types links point to, ...) on threads of their own,
+		/// so independent slow factories overlap instead of running one after another. A construction is only ever started once: calling ResolveAsync
+		/// again returns the same future, and Resolve waits for the instance instead of calling the factory a second time.
+		/// If the construction fails, the future holds the exception and the next ResolveAsync starts it again.
+		/// \tparam T The Singleton to resolve
+		/// \return The instance once it has been constructed
+		/// \throws ContainerException if T is not a Singleton with an instance or a factory without arguments
+		template <class T>
+		std::shared_future<std::shared_ptr<T>> ResolveAsync()
+		{
+			auto root = FindRoot(type_key<T>);
+			if (!root || root->scope != Scope::Singleton){
+				auto ss = std::ostringstream();
+				ss << "Type " << pretty_name<T>() << " is not registered as Singleton";
+				throw ContainerException(ss.str());
+			}
+			if (auto instance = root->instance.load(std::memory_order_acquire)){
+				auto promise = std::promise<std::shared_ptr<T>>();
+				promise.set_value(std::static_pointer_cast<T>(*instance));
+				return promise.get_future().share();
+			}
+			{
+				std::lock_guard lock(root->owner->registrationMutex_);
+				if (!root->constructAsync){
 					auto ss = std::ostringstream();
-					ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " is not registered";
+					ss << "Singleton " << pretty_name<T>() << " has no factory without arguments";
 					throw ContainerException(ss.str());
 				}
+			}
+			return StartConstruction<T>(*root->owner, *root);
+		}
 
-				switch(registeredTypes_[typeid(T)]){
-					case Scope::Singleton:
-						if(container_contains(registeredInstances_, typeid(T))) return std::static_pointer_cast<T>(registeredInstances_[typeid(T)]);
-						if(!container_contains(registeredFactories_, typeid(T))){
-							auto ss = std::ostringstream();
-							ss << "Singleton " << boost::typeindex::type_id<T>().pretty_name() << " has neither an instance nor a factory";
-							throw ContainerException(ss.str());
-						}
-						if(!container_contains(registeredFactories_[typeid(T)], std::vector<std::type_index>{typeid(TArgs) ...})){
-							auto ss = std::ostringstream();
-							ss << "Singleton " << boost::typeindex::type_id<T>().pretty_name() << " has no factory with the supplied arguments";
-							throw ContainerException(ss.str());
-						}
-						registeredInstances_[typeid(T)] = (*std::static_pointer_cast<std::function<std::shared_ptr<T>(TArgs...)>>(registeredFactories_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}]))(std::forward<TArgs>(args) ...);
-						return std::static_pointer_cast<T>(registeredInstances_[typeid(T)]);
-					case Scope::Transient:
-						if(!container_contains(registeredFactories_, typeid(T))){
-							auto ss = std::ostringstream();
-							ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " has no registered factory methods";
-							throw ContainerException(ss.str());
-						}
-						if(!container_contains(registeredFactories_[typeid(T)], std::vector<std::type_index>{typeid(TArgs) ...})){
-							auto ss = std::ostringstream();
-							ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " has no factory method with the supplied arguments";
-							throw ContainerException(ss.str());
-						}
-						return (*std::static_pointer_cast<std::function<std::shared_ptr<T>(TArgs...)>>(registeredFactories_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}]))(std::forward<TArgs>(args) ...);
-					case Scope::Interface:
-						return ResolveInterface<T>(std::forward<TArgs>(args) ...);
-					default:{
-						auto ss = std::ostringstream();
-						ss << "Type " << boost::typeindex::type_id<T>().pretty_name() << " is registered with an invalid Scope";
-						throw ContainerException(ss.str());
+		/// Resolves each of the types Ts without arguments
+		/// \return The instances, in the order of Ts
+		template <class... Ts>
+		std::tuple<std::shared_ptr<Ts>...> ResolveMany()
+		{
+			//braced initialization resolves in order
+			return std::tuple<std::shared_ptr<Ts>...>{Resolve<Ts>() ...};
+		}
+
+		/// \brief Resolves count instances of T with the same arguments, looking T up only once
+		/// \details The arguments are passed to every factory call, so they are never moved from.
+		/// If T is a Transient whose factory takes an Allocator (and no memory resource has been set for T), all instances and their control blocks
+		/// are allocated from a single arena sized for count instances. They then share its lifetime: the arena and all instances are released once
+		/// the last of the returned pointers has been destroyed, so the factory must not keep a pointer to the instance it creates.
+		/// \tparam T The type to resolve
+		/// \tparam TArgs The type of the arguments that will be used when resolving
+		/// \param count Number of instances
+		/// \param args The arguments that will be used when resolving
+		/// \return The instances; count copies of the same one if T is a Singleton
+		template <class T, typename ... TArgs>
+		std::vector<std::shared_ptr<T>> ResolveN(std::size_t count, TArgs &&... args)
+		{
+			auto res = std::vector<std::shared_ptr<T>>();
+			auto binding = FindBinding(type_key<T, arg_t<TArgs> ...>, type_key<T>);
+			if(!binding){
+				res.assign(count, ResolveUnbound<T>(nullptr));
+				return res;
+			}
+			res.reserve(count);
+			if(binding->scope != Scope::Transient){
+				for(std::size_t i = 0; i < count; ++i)
+					res.push_back(ResolveBound<T>(nullptr, *binding, 0u, const_cast<arg_t<TArgs> &>(args) ...));
+				return res;
+			}
+
+			//an allocate_shared control block holds the object, the counters, its vtable pointer and the allocator
+			auto holder = std::make_shared<batch<T>>(count * (sizeof(T) + 4 * sizeof(void *) + alignof(std::max_align_t)));
+			struct BatchGuard{
+				BatchGuard(const Binding *root, std::pmr::memory_resource *resource) : previous(currentBatch_) { currentBatch_ = {root, resource, false}; }
+				~BatchGuard() { currentBatch_ = previous; }
+				batch_arena previous;
+			};
+			{
+				BatchGuard guard(binding->root, &holder->arena);
+				holder->instances.reserve(count);
+				for(std::size_t i = 0; i < count; ++i)
+					holder->instances.push_back(ResolveBound<T>(nullptr, *binding, 0u, const_cast<arg_t<TArgs> &>(args) ...));
+				if(!currentBatch_.used)
+					return std::move(holder->instances);
+			}
+			for(const auto &instance : holder->instances)
+				res.emplace_back(holder, instance.get());
+			return res;
+		}
+
+		/// Resolves all parameterless linked implementations of the interface T (see MultipleInjection) like TryResolve
+		template <class T>
+		ResolveResult<const std::vector<std::shared_ptr<T>>> TryResolveAll()
+		{
+			auto res = ResolveResult<const std::vector<std::shared_ptr<T>>>();
+			res.value_ = ResolveAll<T>(&res.failure_);
+			return res;
+		}
+
+		/// \brief Calls f with every parameterless linked implementation of the interface T, without collecting them in a vector
+		/// \details If all links point to Singletons, the instances are resolved once and reused until a link is added
+		/// \tparam T The Interface whose links to resolve
+		/// \param f Invoked with a const std::shared_ptr<T> & per link
+		template <class T, typename F>
+		requires std::is_invocable_v<F &, const std::shared_ptr<T> &>
+		void ForEachLinked(F &&f)
+		{
+			auto &root = *InterfaceRoot<T>();
+			auto table = root.links.load(std::memory_order_acquire);
+			if (!table || (root.owner == this && (CachedAll<T>(root, table) || Cacheable(*table)))) {
+				for (const auto &instance : *ResolveAllBound<T>(root))
+					f(instance);
+				return;
+			}
+			resolve_record record(root);
+			for (const auto &id_vector : *table)
+			{
+				for (const auto &link : id_vector.second)
+				{
+					const auto instance = (*std::static_pointer_cast<factory_t<T>>(link.factory))(*this, 0u);
+					f(instance);
+				}
+			}
+		}
+//endregion
+//region Memory Resources
+		/// \brief Sets the memory resource Allocator supplies to factories outside of a ResolutionScope
+		/// \param resource The resource or nullptr for the default memory resource; it has to outlive every instance allocated from it
+		void SetMemoryResource(std::pmr::memory_resource *resource) noexcept
+		{
+			resource_.store(resource, std::memory_order_release);
+		}
+
+		/// \brief Sets the memory resource Allocator supplies to the factories of T, also within a ResolutionScope
+		/// \tparam T A registered type
+		/// \param resource The resource or nullptr to use the one of the scope or container; it has to outlive every instance allocated from it
+		/// \throws ContainerException if T is not registered
+		template <class T>
+		void SetMemoryResource(std::pmr::memory_resource *resource)
+		{
+			auto root = bindings_.Find(type_key<T>);
+			if (!root){
+				auto ss = std::ostringstream();
+				ss << "Type " << pretty_name<T>() << " is not registered";
+				throw ContainerException(ss.str());
+			}
+			root->resource.store(resource, std::memory_order_release);
+		}
+//endregion
+//region Freeze
+		/// \brief Validates all registrations and prepares them for resolving; nothing can be registered afterwards
+		/// \details Every dependency of every factory and link (Dependency, Lazy, Provider, Injection, InjectionRuntimeResolved, MultipleInjection and the types links point to)
+		/// is checked once without constructing anything. Afterwards factories resolve their dependencies directly through the bindings determined here
+		/// instead of looking them up on every call.
+		/// \throws ContainerException listing every dependency that cannot be resolved; the container stays unfrozen in that case
+		void Freeze()
+		{
+			std::lock_guard lock(registrationMutex_);
+			if (frozen_.load(std::memory_order_relaxed))
+				return;
+
+			auto errors = std::ostringstream();
+			auto targets = std::vector<std::pair<DependencyInfo *, Binding *>>();
+			bindings_.ForEach([&](const Binding &binding){
+				for (const auto &dependency : binding.dependencies){
+					Binding *target;
+					auto error = CheckDependency(*dependency, target);
+					if (!error.empty())
+						errors << "\n\t" << binding.name() << ": " << error;
+					else if (target)
+						targets.emplace_back(dependency.get(), target);
+				}
+			});
+			if (errors.tellp() > 0)
+				throw ContainerException("Container cannot be frozen, some dependencies cannot be resolved:" + errors.str());
+
+			for (auto [dependency, target] : targets)
+				dependency->target.store(target, std::memory_order_release);
+			frozen_.store(true, std::memory_order_release);
+		}
+
+		/// Whether Freeze() has been called successfully
+		[[nodiscard]] bool IsFrozen() const noexcept
+		{
+			return frozen_.load(std::memory_order_acquire);
+		}
+//endregion
+//region WarmUp
+		/// \brief Constructs all singletons that have a factory without arguments but no instance yet, independent ones concurrently
+		/// \details The order is derived from the dependencies of the factories (Dependency, Injection, MultipleInjection, the types links point to, ...):
+		/// a singleton is only constructed once all singletons it depends on have been. Lazy and Provider dependencies as well as resolving through
+		/// the container inside a factory are not known in advance; the latter may make a construction wait for another one.
+		/// Singletons that depend on each other in a cycle are constructed last, one after another, which reports the cycle.
+		/// Errors do not stop the warm-up, they are reported and the singletons affected are constructed on their first resolve as usual.
+		/// \tparam TExecutor Callable taking a std::function<void()> that runs it at some point, e.g. by posting it to a thread pool
+		/// \param executor The executor; it is called both from WarmUp and from the tasks it runs. If it throws, the task is run by the caller.
+		/// \return The time the whole warm-up and each construction took and what the constructions threw
+		template <typename TExecutor> requires std::is_invocable_v<TExecutor &, std::function<void()>>
+		WarmUpReport WarmUp(TExecutor &&executor)
+		{
+			return WarmUpImpl(std::function<void(std::function<void()>)>(std::forward<TExecutor>(executor)));
+		}
+
+		/// \brief Constructs all singletons that have a factory without arguments but no instance yet on a number of threads created for this
+		/// \details See the overload taking an executor
+		/// \param threads Number of threads to construct on
+		WarmUpReport WarmUp(std::size_t threads = std::thread::hardware_concurrency())
+		{
+			struct Pool{
+				std::mutex mutex;
+				std::condition_variable available;
+				std::deque<std::function<void()>> tasks;
+				bool stopped = false;
+				std::vector<std::thread> workers;
+
+				explicit Pool(std::size_t count){
+					for (std::size_t i = 0; i < std::max<std::size_t>(count, 1u); ++i)
+						workers.emplace_back([this](){
+							for (;;){
+								std::unique_lock lock(mutex);
+								available.wait(lock, [this](){ return stopped || !tasks.empty(); });
+								if (tasks.empty())
+									return;
+								auto task = std::move(tasks.front());
+								tasks.pop_front();
+								lock.unlock();
+								task();
+							}
+						});
+				}
+				~Pool(){
+					{
+						std::lock_guard lock(mutex);
+						stopped = true;
 					}
+					available.notify_all();
+					for (auto &worker : workers)
+						worker.join();
 				}
+			} pool(threads);
+
+			return WarmUpImpl([&pool](std::function<void()> task){
+				{
+					std::lock_guard lock(pool.mutex);
+					pool.tasks.push_back(std::move(task));
+				}
+				pool.available.notify_one();
+			});
+		}
+//endregion
+//region Metrics
+		/// Whether metrics are recorded, which is decided by defining IOC_CONTAINER_METRICS (consistently for all translation units)
+#ifdef IOC_CONTAINER_METRICS
+		static constexpr bool MetricsEnabled = true;
+#else
+		static constexpr bool MetricsEnabled = false;
+#endif
+
+		/// \brief Takes a snapshot of the metrics of all registered types
+		/// \details The counters are read one after another while resolving may go on, so they are not necessarily consistent with each other.
+		/// Without IOC_CONTAINER_METRICS the snapshot is empty.
+		MetricsSnapshot GetMetrics() const
+		{
+			auto snapshot = MetricsSnapshot();
+			snapshot.enabled = MetricsEnabled;
+#ifdef IOC_CONTAINER_METRICS
+			std::lock_guard lock(registrationMutex_);
+			bindings_.ForEach([&](const Binding &binding){
+				if (binding.root != &binding)
+					return;
+				auto &type = snapshot.types.emplace_back();
+				type.name = binding.name();
+				type.resolves = binding.metrics.resolves.load(std::memory_order_relaxed);
+				type.instanceHits = binding.metrics.instanceHits.load(std::memory_order_relaxed);
+				type.factoryCalls = binding.metrics.factoryCalls.load(std::memory_order_relaxed);
+				for (std::size_t i = 0; i < TypeMetrics::histogramBuckets; ++i)
+					type.factoryTime[i] = binding.metrics.factoryTime[i].load(std::memory_order_relaxed);
+				type.maxDepth = binding.metrics.maxDepth.load(std::memory_order_relaxed);
+			});
+#endif
+			return snapshot;
+		}
+//endregion
+//region Resolver
+		/// \brief Creates a handle that resolves T with the argument signature TArgs
+		/// \details The binding is looked up and checked once here; see Resolver
+		/// \tparam T The type to resolve
+		/// \tparam TArgs The (plain) types of the arguments the resolver will be called with
+		/// \throws ContainerException if T cannot be resolved with these arguments
+		template <class T, typename ... TArgs>
+		Resolver<T, arg_t<TArgs> ...> GetResolver()
+		{
+			static_assert(!std::is_same_v<T, Container>, "The container cannot be resolved through a resolver");
+			Binding *binding;
+			auto error = CheckDependency(DependencyInfo(DependencyKind::Resolve, type_key<T>, type_key<T, arg_t<TArgs> ...>, std::string(), &pretty_name<T>), binding);
+			if (!error.empty())
+				throw ContainerException(error);
+
+			//a singleton that only has an instance is resolved through its root binding
+			if (!binding)
+				binding = FindRoot(type_key<T>);
+			switch (binding->scope){
+				case Scope::Singleton:
+					return Resolver<T, arg_t<TArgs> ...>(*this, *binding, &InvokeSingleton<T, arg_t<TArgs> ...>);
+				case Scope::Transient:
+					return Resolver<T, arg_t<TArgs> ...>(*this, *binding, &InvokeTransient<T, arg_t<TArgs> ...>);
+				case Scope::Scoped:
+					return Resolver<T, arg_t<TArgs> ...>(*this, *binding, &InvokeScoped<T, arg_t<TArgs> ...>);
+				default:
+					return Resolver<T, arg_t<TArgs> ...>(*this, *binding, &InvokeInterface<T, arg_t<TArgs> ...>);
 			}
 		}
 //endregion
@@ -0,0 +1,238 @@
+//
+// Created by max on 10/18/26.
+//
+
+#ifndef IOC_STATIC_CONTAINER_H
+#define IOC_STATIC_CONTAINER_H
+
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Container.h"
+
+namespace mabiphmo::ioc_container{
+//region Bindings
+	/// \brief Binds T as Singleton of a StaticContainer
+	/// \details Factory is a function pointer or a lambda without captures returning std::shared_ptr<T>. Like the factories of Container its parameters are
+	/// Container::Dependency, Container::Injection and Container::MultipleInjection first and the arguments supplied when resolving afterwards.
+	/// It is called once, on the first resolve.
+	template <class T, auto Factory>
+	struct StaticSingleton{};
+
+	/// Binds T as Transient of a StaticContainer, see StaticSingleton for Factory
+	template <class T, auto Factory>
+	struct StaticTransient{};
+
+	/// Links TInterface to T (which has to be bound as well) in a StaticContainer
+	template <class TInterface, class T, FixedString id = "">
+	struct StaticLink{};
+
+	/// Declares T to be resolved by the dynamic Container the StaticContainer falls back to
+	template <class T>
+	struct DynamicBinding{};
+//endregion
+//region StaticContainer
+	/// \brief Container whose bindings are fixed at compile time
+	/// \details Resolving looks nothing up at runtime: which binding provides a type is decided at compile time, so resolving a Transient is an inlined
+	/// call of its factory and resolving a Singleton after its first resolve a single check. Resolving a type (or depending on one) that is not bound
+	/// does not compile. Types that are only known at runtime can be declared as DynamicBinding, these are resolved from the dynamic Container
+	/// supplied on construction.
+	///
+	/// <b>Thread safety:</b> Resolving may happen from any number of threads at the same time, a Singleton's factory runs exactly once.
+	/// \tparam TBindings StaticSingleton, StaticTransient, StaticLink and DynamicBinding
+	template <typename... TBindings>
+	class StaticContainer{
+//region Structs
+		/// Whether TBinding provides T (not through a link)
+		template <class T, typename TBinding>
+		struct provides : std::false_type {};
+		template <class T, auto Factory>
+		struct provides<T, StaticSingleton<T, Factory>> : std::true_type {};
+		template <class T, auto Factory>
+		struct provides<T, StaticTransient<T, Factory>> : std::true_type {};
+		template <class T>
+		struct provides<T, DynamicBinding<T>> : std::true_type {};
+
+		/// Whether TBinding links TInterface, with the given id unless any is set
+		template <class TInterface, FixedString id, bool any, typename TBinding>
+		struct links : std::false_type {};
+		template <class TInterface, FixedString id, bool any, class T, FixedString linkId>
+		struct links<TInterface, id, any, StaticLink<TInterface, T, linkId>> : std::bool_constant<any || std::string_view(id) == std::string_view(linkId)> {
+			using type [[maybe_unused]] = T;
+		};
+
+		/// Index of the first binding of TBindings that satisfies TPredicate or sizeof...(TBindings)
+		template <template <typename> class TPredicate>
+		static constexpr std::size_t IndexOf(){
+			std::size_t index = 0;
+			((TPredicate<TBindings>::value ? false : (++index, true)) && ...);
+			return index;
+		}
+
+		template <class T>
+		struct provides_t { template <typename TBinding> using type = provides<T, TBinding>; };
+		template <class TInterface, FixedString id>
+		struct links_t { template <typename TBinding> using type = links<TInterface, id, false, TBinding>; };
+
+		template <class T>
+		static constexpr std::size_t binding_index = IndexOf<provides_t<T>::template type>();
+		template <class TInterface, FixedString id>
+		static constexpr std::size_t link_index = IndexOf<links_t<TInterface, id>::template type>();
+
+		template <std::size_t I>
+		using binding_at = std::tuple_element_t<I, std::tuple<TBindings...>>;
+
+		/// State a binding needs at runtime
+		template <typename TBinding>
+		struct slot {};
+		template <class T, auto Factory>
+		struct slot<StaticSingleton<T, Factory>>{
+			std::once_flag once;
+			std::shared_ptr<T> instance;
+		};
+
+		/// Factory parameters that are resolved by the container
+		template <typename TParam>
+		struct is_dependency : std::false_type {};
+		template <class T>
+		struct is_dependency<Container::Dependency<T>> : std::true_type {};
+		template <class T, FixedString id>
+		struct is_dependency<Container::Injection<T, id>> : std::true_type {};
+		template <class T>
+		struct is_dependency<Container::MultipleInjection<T>> : std::true_type {};
+
+		template <typename TFunction>
+		struct factory_parameters;
+		template <typename R, typename... TParams>
+		struct factory_parameters<std::function<R(TParams...)>>{
+			using type = std::tuple<TParams...>;
+			static constexpr std::size_t dependencies = (static_cast<std::size_t>(is_dependency<std::remove_cvref_t<TParams>>::value) + ... + 0);
+		};
+		template <auto Factory>
+		using factory_parameters_t = factory_parameters<decltype(std::function(Factory))>;
+
+		template <typename TBinding>
+		struct factory_of;
+		template <class T, auto Factory>
+		struct factory_of<StaticSingleton<T, Factory>>{
+			static constexpr auto factory = Factory;
+			static constexpr bool singleton = true;
+		};
+		template <class T, auto Factory>
+		struct factory_of<StaticTransient<T, Factory>>{
+			static constexpr auto factory = Factory;
+			static constexpr bool singleton = false;
+		};
+//endregion
+//region Member Variables
+		std::tuple<slot<TBindings>...> slots_;
+		/// Resolves the DynamicBindings
+		std::shared_ptr<Container> fallback_;
+//endregion
+//region private
+		/// Constructs the factory parameters resolved by the container
+		template <class T>
+		Container::Dependency<T> MakeDependency(std::type_identity<Container::Dependency<T>>){
+			return Container::Dependency<T>(std::in_place, Resolve<T>());
+		}
+		template <class T, FixedString id>
+		Container::Injection<T, id> MakeDependency(std::type_identity<Container::Injection<T, id>>){
+			return Container::Injection<T, id>(std::in_place, ResolveInterface<T, id>());
+		}
+		template <class T>
+		Container::MultipleInjection<T> MakeDependency(std::type_identity<Container::MultipleInjection<T>>){
+			return Container::MultipleInjection<T>(std::in_place, ResolveAll<T>());
+		}
+
+		/// Calls Factory with its dependencies and args
+		template <auto Factory, typename... TArgs>
+		auto Invoke(TArgs &&... args){
+			using parameters = factory_parameters_t<Factory>;
+			static_assert(std::tuple_size_v<typename parameters::type> == parameters::dependencies + sizeof...(TArgs),
+				"The arguments do not match the parameters of the factory");
+			return [&]<std::size_t... I>(std::index_sequence<I...>){
+				return Factory(MakeDependency(std::type_identity<std::remove_cvref_t<std::tuple_element_t<I, typename parameters::type>>>{}) ..., std::forward<TArgs>(args) ...);
+			}(std::make_index_sequence<parameters::dependencies>{});
+		}
+
+		/// Resolves T through the binding at index I
+		template <std::size_t I, class T, typename... TArgs>
+		std::shared_ptr<T> ResolveBinding(TArgs &&... args){
+			using binding = binding_at<I>;
+			if constexpr (std::is_same_v<binding, DynamicBinding<T>>){
+				if (!fallback_)
+					throw ContainerException("Type " + boost::typeindex::type_id<T>().pretty_name() + " is bound dynamically, but there is no Container to fall back to");
+				return fallback_->Resolve<T>(std::forward<TArgs>(args) ...);
+			}
+			else if constexpr (factory_of<binding>::singleton){
+				auto &slot = std::get<I>(slots_);
+				std::call_once(slot.once, [&](){ slot.instance = Invoke<factory_of<binding>::factory>(std::forward<TArgs>(args) ...); });
+				return slot.instance;
+			}
+			else
+				return Invoke<factory_of<binding>::factory>(std::forward<TArgs>(args) ...);
+		}
+
+		/// Resolves all links of TInterface starting at the binding with index I
+		template <class TInterface, std::size_t I = 0>
+		void CollectLinks(std::vector<std::shared_ptr<TInterface>> &res){
+			if constexpr (I < sizeof...(TBindings)){
+				using link = links<TInterface, "", true, binding_at<I>>;
+				if constexpr (link::value)
+					res.emplace_back(Resolve<typename link::type>());
+				CollectLinks<TInterface, I + 1>(res);
+			}
+		}
+//endregion
+	public:
+//region Construction
+		/// Constructs a container that cannot resolve DynamicBindings
+		StaticContainer() = default;
+		/// Constructs a container that resolves DynamicBindings from fallback
+		explicit StaticContainer(std::shared_ptr<Container> fallback) : fallback_(std::move(fallback)) {}
+		StaticContainer(const StaticContainer &) = delete;
+		StaticContainer &operator=(const StaticContainer &) = delete;
+//endregion
+//region Resolving
+		/// Whether T is bound (or has a link without id)
+		template <class T>
+		static constexpr bool Binds = binding_index<T> < sizeof...(TBindings) || link_index<T, ""> < sizeof...(TBindings);
+
+		/// Resolves the type T with the supplied arguments; an interface is resolved through its link without id
+		/// \tparam T The type to resolve
+		/// \tparam TArgs The type of the arguments that will be used when resolving
+		/// \param args The arguments that will be used when resolving
+		/// \return The resolved instance
+		template <class T, typename... TArgs>
+		std::shared_ptr<T> Resolve(TArgs &&... args){
+			static_assert(Binds<T>, "T is not bound in this StaticContainer");
+			if constexpr (binding_index<T> < sizeof...(TBindings))
+				return ResolveBinding<binding_index<T>, T>(std::forward<TArgs>(args) ...);
+			else
+				return ResolveInterface<T, "">(std::forward<TArgs>(args) ...);
+		}
+
+		/// Resolves TInterface through its link with the given id
+		template <class TInterface, FixedString id = "", typename... TArgs>
+		std::shared_ptr<TInterface> ResolveInterface(TArgs &&... args){
+			static_assert(link_index<TInterface, id> < sizeof...(TBindings), "TInterface has no link with this id in this StaticContainer");
+			return Resolve<typename links<TInterface, id, false, binding_at<link_index<TInterface, id>>>::type>(std::forward<TArgs>(args) ...);
+		}
+
+		/// Resolves all links of TInterface, in the order they are declared
+		template <class TInterface>
+		std::vector<std::shared_ptr<TInterface>> ResolveAll(){
+			auto res = std::vector<std::shared_ptr<TInterface>>();
+			CollectLinks<TInterface>(res);
+			return res;
+		}
+//endregion
+	};
+//endregion
+}
+
+#endif //IOC_STATIC_CONTAINER_H
@@ -0,0 +1,27 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/config.hpp>
+
+using namespace mabiphmo::ioc_container;
+
+/// Like BENCHMARK_MAIN, but records what the numbers depend on besides the machine, so results can be compared over time
+int main(int argc, char **argv){
+	benchmark::AddCustomContext("compiler", BOOST_COMPILER);
+#ifdef NDEBUG
+	benchmark::AddCustomContext("assertions", "off");
+#else
+	benchmark::AddCustomContext("assertions", "on");
+#endif
+	benchmark::AddCustomContext("metrics", Container::MetricsEnabled ? "on" : "off");
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
@@ -0,0 +1,44 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <mabiphmo/ioc-container/Container.h>
+#include "benchmarkStructs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace {
+	/// Registers Chain<0> to Chain<Depth> as transients, each depending on the previous one
+	template <std::size_t ... I>
+	std::shared_ptr<Container> SetupChain(std::index_sequence<I...>){
+		auto container = std::make_shared<Container>();
+		RegisterFillers(*container, std::make_index_sequence<128>{});
+		container->RegisterTransient(std::function([](){ return std::make_shared<Chain<0>>(); }));
+		(container->RegisterTransient(std::function([](Container::Dependency<Chain<I>> next){ return std::make_shared<Chain<I + 1>>(next); })), ...);
+		return container;
+	}
+}
+
+template <std::size_t Depth>
+static void DependencyChain(benchmark::State &state){
+	std::shared_ptr<Container> container = SetupChain(std::make_index_sequence<Depth>{});
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->Resolve<Chain<Depth>>());
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Depth + 1));
+}
+BENCHMARK_TEMPLATE(DependencyChain, 1);
+BENCHMARK_TEMPLATE(DependencyChain, 8);
+BENCHMARK_TEMPLATE(DependencyChain, 32);
+
+template <std::size_t Depth>
+static void FrozenDependencyChain(benchmark::State &state){
+	std::shared_ptr<Container> container = SetupChain(std::make_index_sequence<Depth>{});
+	container->Freeze();
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->Resolve<Chain<Depth>>());
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Depth + 1));
+}
+BENCHMARK_TEMPLATE(FrozenDependencyChain, 1);
+BENCHMARK_TEMPLATE(FrozenDependencyChain, 8);
+BENCHMARK_TEMPLATE(FrozenDependencyChain, 32);
@@ -0,0 +1,71 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <mabiphmo/ioc-container/Container.h>
+#include "../container/structs.h"
+#include "benchmarkStructs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace {
+	/// Registers CImpl as singleton and links it to IC as default, with the ids "3" and "5" and with linkCount - 3 further ids
+	std::shared_ptr<Container> Setup(std::size_t linkCount = 3){
+		auto container = std::make_shared<Container>();
+		RegisterFillers(*container, std::make_index_sequence<128>{});
+		container->RegisterSingleton(std::function([](unsigned val){ return std::make_shared<CImpl>(val); }));
+		container->RegisterOnInterface<IC, CImpl>(1u);
+		container->RegisterOnInterface<IC, CImpl, "3">(3u);
+		container->RegisterOnInterface<IC, CImpl, "5">(5u);
+		for (std::size_t i = 3; i < linkCount; ++i)
+			container->RegisterOnInterfaceRuntimeId<IC, CImpl>(std::to_string(i + 3), 7u);
+		return container;
+	}
+}
+
+static void InterfaceDefault(benchmark::State &state){
+	auto container = Setup();
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->Resolve<IC>());
+}
+BENCHMARK(InterfaceDefault);
+
+static void InterfaceCompileTimeId(benchmark::State &state){
+	auto container = Setup();
+	for (auto _ : state)
+		benchmark::DoNotOptimize(Container::Injection<IC, "5">(container).value);
+}
+BENCHMARK(InterfaceCompileTimeId);
+
+static void InterfaceRuntimeId(benchmark::State &state){
+	auto container = Setup();
+	auto id = std::string("5");
+	for (auto _ : state)
+		benchmark::DoNotOptimize(Container::InjectionRuntimeResolved<IC>(container, id).value);
+}
+BENCHMARK(InterfaceRuntimeId);
+
+static void InterfaceInternedId(benchmark::State &state){
+	auto container = Setup();
+	auto id = RuntimeId("5");
+	for (auto _ : state)
+		benchmark::DoNotOptimize(Container::InjectionRuntimeResolved<IC, RuntimeId>(container, id).value);
+}
+BENCHMARK(InterfaceInternedId);
+
+static void ResolveAll(benchmark::State &state){
+	auto container = Setup(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state)
+		benchmark::DoNotOptimize(Container::MultipleInjection<IC>(container).value);
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ResolveAll)->RangeMultiplier(4)->Range(4, 256);
+
+static void ForEachLinked(benchmark::State &state){
+	auto container = Setup(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state)
+		container->ForEachLinked<IC>([](const std::shared_ptr<IC> &c){ benchmark::DoNotOptimize(c.get()); });
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ForEachLinked)->RangeMultiplier(4)->Range(4, 256);
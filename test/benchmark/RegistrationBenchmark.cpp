@@ -0,0 +1,57 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <mabiphmo/ioc-container/Container.h>
+#include "../container/structs.h"
+#include "benchmarkStructs.h"
+
+using namespace mabiphmo::ioc_container;
+
+//every registered type instantiates the whole registration path, which limits how many distinct types a benchmark can afford to compile
+template <std::size_t Count>
+static void Registration(benchmark::State &state){
+	for (auto _ : state){
+		auto container = std::make_shared<Container>();
+		RegisterFillers(*container, std::make_index_sequence<Count>{});
+		benchmark::DoNotOptimize(container.get());
+		//destroying the container is not part of registering
+		state.PauseTiming();
+		container.reset();
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Count));
+}
+BENCHMARK_TEMPLATE(Registration, 16);
+BENCHMARK_TEMPLATE(Registration, 256);
+
+static void LinkRegistration(benchmark::State &state){
+	auto ids = std::vector<std::string>();
+	for (std::int64_t i = 0; i < state.range(0); ++i)
+		ids.push_back(std::to_string(i));
+	for (auto _ : state){
+		auto container = std::make_shared<Container>();
+		container->RegisterSingleton(std::make_shared<CImpl>(5u));
+		for (const auto &id : ids)
+			container->RegisterOnInterfaceRuntimeId<IC, CImpl>(id);
+		benchmark::DoNotOptimize(container.get());
+		state.PauseTiming();
+		container.reset();
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(LinkRegistration)->RangeMultiplier(4)->Range(64, 1024);
+
+//a child shares the registrations of its parent, so creating one does not depend on how much the parent has registered
+static void CreateChild(benchmark::State &state){
+	auto parent = std::make_shared<Container>();
+	RegisterFillers(*parent, std::make_index_sequence<256>{});
+	for (auto _ : state){
+		auto child = parent->CreateChild();
+		child->RegisterSingleton(std::make_shared<A>(3u));
+		benchmark::DoNotOptimize(child->Resolve<Filler<0>>());
+	}
+}
+BENCHMARK(CreateChild);
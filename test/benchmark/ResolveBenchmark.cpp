@@ -0,0 +1,217 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <mabiphmo/ioc-container/Container.h>
+#include <typeindex>
+#include <memory_resource>
+#include <boost/functional/hash.hpp>
+#include "../container/structs.h"
+#include "benchmarkStructs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace {
+	/// The registry layout the container used before the flat map: nested hash maps keyed by std::type_index and a std::vector of the argument type_indices
+	class LegacyRegistry {
+		template<typename TContainer>
+		struct container_hash {
+			std::size_t operator()(const TContainer &container) const{
+				return boost::hash_range(container.begin(), container.end());
+			}
+		};
+
+		template<typename TContainer, typename TKey>
+		static bool container_contains(const TContainer& container, const TKey& key)
+		{
+			return container.find(key) != container.end();
+		}
+
+		enum class Scope{ Singleton, Transient };
+
+		std::unordered_map<std::type_index, Scope> registeredTypes_;
+		std::unordered_map<std::type_index, std::unordered_map<std::vector<std::type_index>, std::shared_ptr<void>, container_hash<std::vector<std::type_index>>>> registeredFactories_;
+		std::unordered_map<std::type_index, std::shared_ptr<void>> registeredInstances_;
+	public:
+		template <class T, typename... TArgs>
+		void RegisterSingleton(std::function<std::shared_ptr<T>(TArgs ...)> pFactory){
+			registeredTypes_[typeid(T)] = Scope::Singleton;
+			registeredFactories_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}] = std::make_shared<std::function<std::shared_ptr<T>(TArgs &&...)>>(
+					[factory = std::make_shared<std::function<std::shared_ptr<T>(TArgs ...)>>(std::move(pFactory))](TArgs &&... args){ return (*factory)(std::forward<TArgs>(args) ...); });
+		}
+
+		template <class T, typename... TArgs>
+		void RegisterTransient(std::function<std::shared_ptr<T>(TArgs ...)> pFactory){
+			registeredTypes_[typeid(T)] = Scope::Transient;
+			registeredFactories_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}] = std::make_shared<std::function<std::shared_ptr<T>(TArgs &&...)>>(
+					[factory = std::make_shared<std::function<std::shared_ptr<T>(TArgs ...)>>(std::move(pFactory))](TArgs &&... args){ return (*factory)(std::forward<TArgs>(args) ...); });
+		}
+
+		template <class T, typename ... TArgs>
+		std::shared_ptr<T> Resolve(TArgs &&... args)
+		{
+			if(!container_contains(registeredTypes_, typeid(T)))
+				throw ContainerException("not registered");
+			switch(registeredTypes_[typeid(T)]){
+				case Scope::Singleton:
+					if(container_contains(registeredInstances_, typeid(T))) return std::static_pointer_cast<T>(registeredInstances_[typeid(T)]);
+					if(!container_contains(registeredFactories_, typeid(T)) || !container_contains(registeredFactories_[typeid(T)], std::vector<std::type_index>{typeid(TArgs) ...}))
+						throw ContainerException("no factory");
+					registeredInstances_[typeid(T)] = (*std::static_pointer_cast<std::function<std::shared_ptr<T>(TArgs...)>>(registeredFactories_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}]))(std::forward<TArgs>(args) ...);
+					return std::static_pointer_cast<T>(registeredInstances_[typeid(T)]);
+				case Scope::Transient:
+					if(!container_contains(registeredFactories_, typeid(T)) || !container_contains(registeredFactories_[typeid(T)], std::vector<std::type_index>{typeid(TArgs) ...}))
+						throw ContainerException("no factory");
+					return (*std::static_pointer_cast<std::function<std::shared_ptr<T>(TArgs...)>>(registeredFactories_[typeid(T)][std::vector<std::type_index>{typeid(TArgs) ...}]))(std::forward<TArgs>(args) ...);
+			}
+			throw ContainerException("invalid scope");
+		}
+	};
+
+	template <typename TContainer>
+	void Setup(TContainer &container){
+		RegisterFillers(container, std::make_index_sequence<128>{});
+		container.RegisterSingleton(std::function([](){ return std::make_shared<A>(3u); }));
+		container.RegisterTransient(std::function([](unsigned a, unsigned b){ return std::make_shared<B>(std::make_shared<A>(a), b); }));
+	}
+}
+
+static void LegacySingleton(benchmark::State &state){
+	LegacyRegistry legacy;
+	Setup(legacy);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(legacy.Resolve<A>());
+}
+BENCHMARK(LegacySingleton);
+
+static void FlatSingleton(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->Resolve<A>());
+}
+BENCHMARK(FlatSingleton);
+
+static void MissingThrowing(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	for (auto _ : state) {
+		try {
+			benchmark::DoNotOptimize(container->Resolve<D>());
+		}
+		catch (const ContainerException &) {}
+	}
+}
+BENCHMARK(MissingThrowing);
+
+static void MissingTry(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->TryResolve<D>());
+}
+BENCHMARK(MissingTry);
+
+static void LegacyTransientWithArgs(benchmark::State &state){
+	LegacyRegistry legacy;
+	Setup(legacy);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(legacy.Resolve<B>(1u, 2u));
+}
+BENCHMARK(LegacyTransientWithArgs);
+
+static void FlatTransientWithArgs(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->Resolve<B>(1u, 2u));
+}
+BENCHMARK(FlatTransientWithArgs);
+
+static void ResolverSingleton(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	auto resolver = container->GetResolver<A>();
+	for (auto _ : state)
+		benchmark::DoNotOptimize(resolver());
+}
+BENCHMARK(ResolverSingleton);
+
+static void ResolverTransientWithArgs(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	auto resolver = container->GetResolver<B, unsigned, unsigned>();
+	for (auto _ : state)
+		benchmark::DoNotOptimize(resolver(1u, 2u));
+}
+BENCHMARK(ResolverTransientWithArgs);
+
+static void ConcurrentSingleton(benchmark::State &state){
+	static std::shared_ptr<Container> container;
+	if(state.thread_index() == 0){
+		container = std::make_shared<Container>();
+		Setup(*container);
+	}
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->Resolve<A>());
+	if(state.thread_index() == 0)
+		container.reset();
+}
+BENCHMARK(ConcurrentSingleton)->ThreadRange(1, 8)->UseRealTime();
+
+static void TransientDefaultAllocation(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	container->RegisterTransient(std::function([](unsigned b){ return std::make_shared<B>(nullptr, b); }));
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->Resolve<B>(2u));
+}
+BENCHMARK(TransientDefaultAllocation);
+
+static void TransientPoolAllocation(benchmark::State &state){
+	std::pmr::unsynchronized_pool_resource pool;
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	container->RegisterTransient(std::function([](Container::Allocator allocator, unsigned b){ return allocator.MakeShared<B>(nullptr, b); }));
+	container->SetMemoryResource<B>(&pool);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->Resolve<B>(2u));
+}
+BENCHMARK(TransientPoolAllocation);
+
+static void TransientScopeAllocation(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	Setup(*container);
+	container->RegisterTransient(std::function([](Container::Allocator allocator, unsigned b){ return allocator.MakeShared<B>(nullptr, b); }));
+	//a scope per batch of resolves, as it would be per request
+	while (state.KeepRunningBatch(16)){
+		Container::ResolutionScope scope(container);
+		for (int i = 0; i < 16; ++i)
+			benchmark::DoNotOptimize(scope.Resolve<B>(2u));
+	}
+}
+BENCHMARK(TransientScopeAllocation);
+
+static void TransientLoop(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	container->RegisterTransient(std::function([](Container::Allocator allocator, unsigned b){ return allocator.MakeShared<B>(nullptr, b); }));
+	for (auto _ : state){
+		auto instances = std::vector<std::shared_ptr<B>>();
+		instances.reserve(static_cast<std::size_t>(state.range(0)));
+		for (std::int64_t i = 0; i < state.range(0); ++i)
+			instances.push_back(container->Resolve<B>(2u));
+		benchmark::DoNotOptimize(instances.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(TransientLoop)->Arg(1024);
+
+static void TransientBatch(benchmark::State &state){
+	auto container = std::make_shared<Container>();
+	container->RegisterTransient(std::function([](Container::Allocator allocator, unsigned b){ return allocator.MakeShared<B>(nullptr, b); }));
+	for (auto _ : state)
+		benchmark::DoNotOptimize(container->ResolveN<B>(static_cast<std::size_t>(state.range(0)), 2u).data());
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(TransientBatch)->Arg(1024);
@@ -0,0 +1,31 @@
+//
+// Created by max on 10/18/26.
+//
+
+#ifndef IOC_BENCHMARK_STRUCTS_H
+#define IOC_BENCHMARK_STRUCTS_H
+
+#include <memory>
+#include <functional>
+#include <utility>
+
+template <std::size_t N>
+struct Filler{};
+
+/// Registers some unrelated types so lookups do not run against an almost empty registry
+template <typename TContainer, std::size_t ... I>
+void RegisterFillers(TContainer &container, std::index_sequence<I...>){
+	(container.RegisterTransient(std::function([](){ return std::make_shared<Filler<I>>(); })), ...);
+}
+
+/// Link N of a dependency chain, Chain<0> has no dependencies
+template <std::size_t N>
+struct Chain{
+	explicit Chain(std::shared_ptr<Chain<N - 1>> next_) : next(std::move(next_)) {}
+	std::shared_ptr<Chain<N - 1>> next;
+};
+
+template <>
+struct Chain<0>{};
+
+#endif //IOC_BENCHMARK_STRUCTS_H
@@ -50,5 +50,32 @@ BOOST_AUTO_TEST_SUITE(Args)
 		BOOST_TEST(inst->a == 3u);
 	}
 
+	BOOST_AUTO_TEST_CASE(valueCategories)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val) { return std::make_shared<lvalueArgs>(val); }));
+		auto arg = 3u;
+		const auto constArg = 4u;
+		BOOST_TEST(uut->Resolve<lvalueArgs>(arg)->a == 3u);
+		BOOST_TEST(uut->Resolve<lvalueArgs>(constArg)->a == 4u);
+		BOOST_TEST(uut->Resolve<lvalueArgs>(5u)->a == 5u);
+	}
+
+	BOOST_AUTO_TEST_CASE(lvalueNotMovedFrom)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](std::string val) { return std::make_shared<stringArgs>(std::move(val)); }));
+		auto arg = std::string("an argument that does not fit into the small string buffer");
+		BOOST_TEST(uut->Resolve<stringArgs>(arg)->a == arg);
+		BOOST_TEST(uut->Resolve<stringArgs>(std::move(arg))->a == "an argument that does not fit into the small string buffer");
+	}
+
+	BOOST_AUTO_TEST_CASE(moveOnly)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](std::unique_ptr<unsigned> val) { return std::make_shared<lvalueArgs>(*val); }));
+		BOOST_TEST(uut->Resolve<lvalueArgs>(std::make_unique<unsigned>(3u))->a == 3u);
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
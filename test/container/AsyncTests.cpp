@@ -0,0 +1,103 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include <future>
+#include <atomic>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(Async)
+
+	BOOST_AUTO_TEST_CASE(Concurrent)
+	{
+		//each factory only finishes once the other one has started, so they have to run at the same time
+		std::promise<void> aStarted, cStarted;
+		auto aStartedFuture = aStarted.get_future().share();
+		auto cStartedFuture = cStarted.get_future().share();
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingletonAsync(std::function([&aStarted, cStartedFuture](){
+			aStarted.set_value();
+			return std::async(std::launch::async, [cStartedFuture](){
+				if (cStartedFuture.wait_for(std::chrono::seconds(10)) != std::future_status::ready)
+					throw std::runtime_error("The factories do not run concurrently");
+				return std::make_shared<A>(3u);
+			});
+		}));
+		uut->RegisterSingletonAsync(std::function([&cStarted, aStartedFuture](){
+			cStarted.set_value();
+			return std::async(std::launch::async, [aStartedFuture](){
+				if (aStartedFuture.wait_for(std::chrono::seconds(10)) != std::future_status::ready)
+					throw std::runtime_error("The factories do not run concurrently");
+				return std::make_shared<CImpl>(5u);
+			}).share();
+		}));
+		uut->RegisterSingleton(std::function([](Container::Dependency<A> a, Container::Dependency<CImpl> c){
+			return std::make_shared<D>(std::make_shared<B>(a, 1u), c.value, 0u);
+		}));
+		auto d = uut->ResolveAsync<D>();
+		BOOST_TEST(d.get()->sum == 1u + 3u + 5u);
+		BOOST_TEST(uut->Resolve<D>() == d.get());
+		BOOST_TEST(uut->ResolveAsync<A>().get() == uut->Resolve<A>());
+	}
+
+	BOOST_AUTO_TEST_CASE(ResolveWaits)
+	{
+		std::promise<void> release;
+		auto released = release.get_future().share();
+		std::atomic<unsigned> constructed = 0;
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingletonAsync(std::function([&constructed, released](){
+			++constructed;
+			return std::async(std::launch::async, [released](){
+				released.wait();
+				return std::make_shared<A>(3u);
+			});
+		}));
+		auto first = uut->ResolveAsync<A>();
+		auto second = uut->ResolveAsync<A>();
+		auto releaser = std::thread([&release](){
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			release.set_value();
+		});
+		auto a = uut->Resolve<A>();
+		releaser.join();
+		BOOST_TEST(first.get() == a);
+		BOOST_TEST(second.get() == a);
+		BOOST_TEST(constructed == 1u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Retry)
+	{
+		auto attempts = 0u;
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingletonAsync(std::function([&attempts](){
+			return std::async(std::launch::deferred, [attempts = ++attempts](){
+				if (attempts == 1u)
+					throw std::runtime_error("not yet");
+				return std::make_shared<A>(3u);
+			});
+		}));
+		BOOST_CHECK_THROW(uut->ResolveAsync<A>().get(), std::runtime_error);
+		BOOST_TEST(uut->ResolveAsync<A>().get()->a == 3u);
+		BOOST_TEST(attempts == 2u);
+	}
+
+	BOOST_AUTO_TEST_CASE(NotAsync)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](){ return std::make_shared<A>(3u); }));
+		uut->RegisterSingleton(std::function([](unsigned value){ return std::make_shared<B>(nullptr, value); }));
+		uut->RegisterSingleton(std::make_shared<CImpl>(5u));
+		BOOST_CHECK_THROW(uut->ResolveAsync<A>(), ContainerException);
+		BOOST_CHECK_THROW(uut->ResolveAsync<B>(), ContainerException);
+		BOOST_CHECK_THROW(uut->ResolveAsync<D>(), ContainerException);
+		BOOST_TEST(uut->ResolveAsync<CImpl>().get()->C() == 5u);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(Child)
+
+	BOOST_AUTO_TEST_CASE(Inherited)
+	{
+		auto parent = std::make_shared<Container>();
+		parent->RegisterSingleton(std::function([](){return std::make_shared<A>(3u);}));
+		parent->RegisterTransient(std::function([](Container::Dependency<A> a, unsigned value){return std::make_shared<B>(a, value);}));
+		auto child = parent->CreateChild();
+		BOOST_TEST(child->Parent() == parent);
+		BOOST_TEST(child->Resolve<A>() == parent->Resolve<A>());
+		BOOST_TEST(child->Resolve<B>(4u)->b == 4u);
+		BOOST_TEST(child->Resolve<Container>() == child);
+
+		//registered after the child has been created
+		parent->RegisterTransient(std::function([](){return std::make_shared<CImpl>(5u);}));
+		BOOST_TEST(child->Resolve<CImpl>()->C() == 5u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Override)
+	{
+		auto parent = std::make_shared<Container>();
+		parent->RegisterSingleton(std::make_shared<A>(3u));
+		parent->RegisterTransient(std::function([](Container::Dependency<A> a, unsigned value){return std::make_shared<B>(a, value);}));
+		parent->RegisterTransient(std::function([](unsigned value){return std::make_shared<CImpl>(value);}));
+		parent->RegisterTransient(std::function([](){return std::make_shared<CImpl>(1u);}));
+		parent->RegisterOnInterface<IC, CImpl>(5u);
+		auto child = parent->CreateChild();
+		child->RegisterSingleton(std::make_shared<A>(7u));
+		child->RegisterTransient(std::function([](unsigned value){return std::make_shared<CImpl>(value + 4u);}));
+
+		BOOST_TEST(child->Resolve<A>()->a == 7u);
+		BOOST_TEST(parent->Resolve<A>()->a == 3u);
+		//inherited transients and links resolve through the child
+		BOOST_TEST(child->Resolve<B>(1u)->a->a == 7u);
+		BOOST_TEST(parent->Resolve<B>(1u)->a->a == 3u);
+		BOOST_TEST(child->Resolve<IC>()->C() == 9u);
+		BOOST_TEST(parent->Resolve<IC>()->C() == 5u);
+		//the override hides all of the parent's factories of the type
+		BOOST_CHECK_THROW(child->Resolve<CImpl>(), ContainerException);
+
+		auto sibling = parent->CreateChild();
+		BOOST_TEST(sibling->Resolve<A>()->a == 3u);
+	}
+
+	BOOST_AUTO_TEST_CASE(SharedSingletons)
+	{
+		auto parent = std::make_shared<Container>();
+		auto constructed = 0u;
+		parent->RegisterSingleton(std::function([&constructed](Container::Dependency<A> a){++constructed; return std::make_shared<B>(a, 1u);}));
+		parent->RegisterSingleton(std::make_shared<A>(3u));
+		auto first = parent->CreateChild();
+		auto second = parent->CreateChild();
+		first->RegisterSingleton(std::make_shared<A>(7u));
+		//the parent constructs its singletons with its own dependencies
+		BOOST_TEST(first->Resolve<B>()->a->a == 3u);
+		BOOST_TEST(second->Resolve<B>() == first->Resolve<B>());
+		BOOST_TEST(parent->Resolve<B>() == first->Resolve<B>());
+		BOOST_TEST(constructed == 1u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Interfaces)
+	{
+		auto parent = std::make_shared<Container>();
+		parent->RegisterSingleton(std::function([](unsigned value){return std::make_shared<CImpl>(value);}));
+		parent->RegisterOnInterface<IC, CImpl>(5u);
+		auto child = parent->CreateChild();
+		BOOST_TEST(child->TryResolveAll<IC>()->size() == 1u);
+		child->RegisterSingleton(std::function([](){return std::make_shared<CImpl>(9u);}));
+		child->RegisterOnInterface<IC, CImpl, "child">();
+		BOOST_TEST(child->TryResolveAll<IC>()->size() == 1u);
+		BOOST_TEST((child->TryResolveInterface<IC, "child">()->C() == 9u));
+		BOOST_TEST(parent->TryResolveAll<IC>()->front()->C() == 5u);
+		BOOST_TEST((!parent->TryResolveInterface<IC, "child">()));
+	}
+
+	BOOST_AUTO_TEST_CASE(Frozen)
+	{
+		auto parent = std::make_shared<Container>();
+		parent->RegisterSingleton(std::make_shared<A>(3u));
+		parent->RegisterTransient(std::function([](Container::Dependency<A> a){return std::make_shared<B>(a, 1u);}));
+		parent->Freeze();
+		auto child = parent->CreateChild();
+		child->RegisterSingleton(std::make_shared<A>(7u));
+		child->RegisterTransient(std::function([](Container::Dependency<B> b){return std::make_shared<D>(b, std::make_shared<CImpl>(0u), 0u);}));
+		child->Freeze();
+		BOOST_TEST(child->IsFrozen());
+		//the parent's frozen dependencies do not bypass the child's override
+		BOOST_TEST(child->Resolve<D>()->b->a->a == 7u);
+		BOOST_TEST(parent->Resolve<B>()->a->a == 3u);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
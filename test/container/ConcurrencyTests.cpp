@@ -0,0 +1,118 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include <thread>
+#include <atomic>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace {
+	template <std::size_t N>
+	struct Filler{};
+
+	template <std::size_t ... I>
+	void RegisterFillers(Container &container, std::index_sequence<I...>){
+		(container.RegisterTransient(std::function([](){ return std::make_shared<Filler<I>>(); })), ...);
+	}
+
+	/// Runs fn on threadCount threads that are released at the same time
+	template <typename F>
+	void RunConcurrently(unsigned threadCount, F &&fn){
+		auto start = std::atomic<bool>(false);
+		auto threads = std::vector<std::thread>();
+		for(auto i = 0u; i < threadCount; ++i)
+			threads.emplace_back([&, i](){
+				while(!start.load()) std::this_thread::yield();
+				fn(i);
+			});
+		start = true;
+		for(auto &thread : threads)
+			thread.join();
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(Concurrency)
+
+	BOOST_AUTO_TEST_CASE(SingletonFactory)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::function([](){ return std::make_shared<A>(3u); }));
+		auto instances = std::vector<std::shared_ptr<A>>(8);
+		RunConcurrently(8, [&](unsigned i){ instances[i] = uut->Resolve<A>(); });
+		for(const auto &instance : instances)
+			BOOST_TEST(instance == uut->Resolve<A>());
+	}
+
+	BOOST_AUTO_TEST_CASE(SingletonFactoryRunsOnce)
+	{
+		auto uut = std::make_shared<Container>();
+		auto calls = std::atomic<unsigned>(0);
+		uut->RegisterSingleton(std::function([&](){
+			++calls;
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			return std::make_shared<A>(3u);
+		}));
+		RunConcurrently(8, [&](unsigned){ uut->Resolve<A>(); });
+		BOOST_TEST(calls == 1u);
+	}
+
+	BOOST_AUTO_TEST_CASE(SingletonFactoryThrows)
+	{
+		auto uut = std::make_shared<Container>();
+		auto calls = 0u;
+		uut->RegisterSingleton(std::function([&](){
+			if(++calls == 1) throw std::runtime_error("first construction fails");
+			return std::make_shared<A>(3u);
+		}));
+		BOOST_CHECK_THROW(uut->Resolve<A>(), std::runtime_error);
+		BOOST_TEST(uut->Resolve<A>()->a == 3u);
+		BOOST_TEST(calls == 2u);
+	}
+
+	BOOST_AUTO_TEST_CASE(SingletonDependsOnItself)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::function([](Container::Dependency<A> a){ return std::make_shared<A>(a.value->a); }));
+		BOOST_CHECK_THROW(uut->Resolve<A>(), ContainerException);
+	}
+
+	BOOST_AUTO_TEST_CASE(RegisterWhileResolving)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val){ return std::make_shared<A>(val); }));
+		auto failures = std::atomic<unsigned>(0);
+		RunConcurrently(4, [&](unsigned i){
+			if(i == 0)
+				RegisterFillers(*uut, std::make_index_sequence<256>{});
+			else
+				for(auto j = 0u; j < 10000; ++j)
+					if(uut->Resolve<A>(j)->a != j) ++failures;
+		});
+		BOOST_TEST(failures == 0u);
+		BOOST_TEST(uut->Resolve<Filler<255>>() != nullptr);
+	}
+
+	BOOST_AUTO_TEST_CASE(LinkWhileResolving)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val){ return std::make_shared<CImpl>(val); }));
+		uut->RegisterOnInterface<IC, CImpl>(1u);
+		auto failures = std::atomic<unsigned>(0);
+		RunConcurrently(4, [&](unsigned i){
+			if(i == 0)
+				for(auto j = 0u; j < 100; ++j)
+					uut->RegisterOnInterfaceRuntimeId<IC, CImpl>(std::to_string(j), j);
+			else
+				for(auto j = 0u; j < 10000; ++j)
+					if(uut->Resolve<IC>()->C() != 1u) ++failures;
+		});
+		BOOST_TEST(failures == 0u);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
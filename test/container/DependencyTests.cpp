@@ -49,5 +49,108 @@ BOOST_AUTO_TEST_SUITE(Dependency)
 		BOOST_TEST(inst->c->C() == 3u);
 	}
 
+	BOOST_AUTO_TEST_CASE(InjectionWithInternedId)
+	{
+		auto uut = std::make_shared<Container>();
+		auto five = RuntimeId("5");
+		uut->RegisterTransient(std::function([](unsigned val) { return std::make_shared<CImpl>(val); }));
+		uut->RegisterOnInterfaceRuntimeId<IC, CImpl>(five, 5u);
+		uut->RegisterOnInterface<IC, CImpl, "3">(3u);
+		uut->RegisterTransient(std::function([](Container::InjectionRuntimeResolved<IC, RuntimeId> c) {
+			return std::make_shared<D>(std::make_shared<B>(std::make_shared<A>(3), 4), c, 8);
+		}));
+		BOOST_TEST(uut->Resolve<D>(five)->c->C() == 5u);
+		BOOST_TEST(uut->Resolve<D>(RuntimeId("3"))->c->C() == 3u);
+		BOOST_TEST((RuntimeId("3") == RuntimeId(std::string("3"))));
+		BOOST_TEST(uut->TryResolveInterfaceRuntimeId<IC>(std::string_view("5"))->C() == 5u);
+		BOOST_TEST((uut->TryResolveInterfaceRuntimeId<IC>(RuntimeId("7")).Error().Code() == Container::ResolveError::NoLink));
+	}
+
+	BOOST_AUTO_TEST_CASE(Lazy)
+	{
+		auto uut = std::make_shared<Container>();
+		auto constructed = 0u;
+		uut->RegisterSingleton(std::function([&constructed](){++constructed; return std::make_shared<A>(3u);}));
+		uut->RegisterTransient(std::function([](Container::Lazy<A> a, unsigned value){
+			BOOST_TEST(a->a == 3u);
+			return std::make_shared<B>(nullptr, value);
+		}));
+		std::shared_ptr<A> deferred;
+		uut->RegisterTransient(std::function([&deferred](Container::Lazy<A> a){
+			deferred = a;
+			return std::make_shared<CImpl>(1u);
+		}));
+		auto lazy = Container::Lazy<A>(uut);
+		BOOST_TEST(constructed == 0u);
+		BOOST_TEST(uut->Resolve<B>(5u)->b == 5u);
+		BOOST_TEST(constructed == 1u);
+		BOOST_TEST(lazy.Get() == uut->Resolve<A>());
+		uut->Resolve<CImpl>();
+		BOOST_TEST(deferred == uut->Resolve<A>());
+	}
+
+	BOOST_AUTO_TEST_CASE(Provider)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned value){return std::make_shared<A>(value);}));
+		uut->RegisterSingleton(std::function([](Container::Provider<A, unsigned> a){
+			BOOST_TEST(a(1u) != a(1u));
+			return std::make_shared<B>(a(2u), 4u);
+		}));
+		uut->Freeze();
+		BOOST_TEST(uut->Resolve<B>()->a->a == 2u);
+	}
+
+	BOOST_AUTO_TEST_CASE(LazyExpired)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::make_shared<A>(3u));
+		auto lazy = Container::Lazy<A>(uut);
+		uut.reset();
+		BOOST_CHECK_THROW(lazy.Get(), ContainerException);
+	}
+
+	BOOST_AUTO_TEST_CASE(MultipleInjectionCached)
+	{
+		auto uut = std::make_shared<Container>();
+		auto constructed = 0u;
+		uut->RegisterSingleton(std::function([&constructed](unsigned val){++constructed; return std::make_shared<CImpl>(val);}));
+		uut->RegisterOnInterface<IC, CImpl>(5u);
+		uut->RegisterOnInterface<IC, CImpl, "3">(3u);
+		auto first = Container::MultipleInjection<IC>(uut);
+		auto second = Container::MultipleInjection<IC>(uut);
+		BOOST_TEST(first.size() == 2u);
+		BOOST_TEST(&first.value == &second.value);
+		BOOST_TEST(constructed == 1u);
+		uut->RegisterOnInterface<IC, CImpl, "7">(7u);
+		auto third = Container::MultipleInjection<IC>(uut);
+		BOOST_TEST(third.size() == 3u);
+		BOOST_TEST(&third.value != &first.value);
+		BOOST_TEST(first.size() == 2u);
+	}
+
+	BOOST_AUTO_TEST_CASE(MultipleInjectionTransient)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val){return std::make_shared<CImpl>(val);}));
+		uut->RegisterOnInterface<IC, CImpl>(5u);
+		auto first = Container::MultipleInjection<IC>(uut);
+		auto second = Container::MultipleInjection<IC>(uut);
+		BOOST_TEST(first.size() == 1u);
+		BOOST_TEST(first.value.front() != second.value.front());
+	}
+
+	BOOST_AUTO_TEST_CASE(ForEachLinked)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val){return std::make_shared<CImpl>(val);}));
+		uut->RegisterOnInterface<IC, CImpl, "5">(5u);
+		uut->RegisterOnInterface<IC, CImpl, "3">(3u);
+		auto sum = 0u;
+		uut->ForEachLinked<IC>([&sum](const std::shared_ptr<IC> &c){ sum += c->C(); });
+		BOOST_TEST(sum == 8u);
+		BOOST_CHECK_THROW(uut->ForEachLinked<A>([](const std::shared_ptr<A> &){}), ContainerException);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,67 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(Freeze)
+
+	BOOST_AUTO_TEST_CASE(ResolveFrozen)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::make_shared<A>(3u));
+		uut->RegisterTransient(std::function([](Container::Dependency<A> a, unsigned value){return std::make_shared<B>(a, value);}));
+		uut->RegisterSingleton(std::function([](unsigned val){return std::make_shared<CImpl>(val);}));
+		uut->RegisterOnInterface<IC, CImpl>(5u);
+		uut->RegisterTransient(std::function([](Container::Injection<IC> c, Container::MultipleInjection<IC> all) {
+			BOOST_TEST(all.value.size() == 1u);
+			return std::make_shared<D>(std::make_shared<B>(std::make_shared<A>(3), 4), c, 8);
+		}));
+		uut->Freeze();
+		BOOST_TEST(uut->IsFrozen());
+		BOOST_TEST(uut->Resolve<B>(5u)->a == uut->Resolve<A>());
+		auto inst = uut->Resolve<D>();
+		BOOST_TEST(inst->sum == 20u);
+		BOOST_TEST(inst->c == uut->Resolve<IC>());
+	}
+
+	BOOST_AUTO_TEST_CASE(MissingDependency)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](Container::Dependency<A> a, unsigned value){return std::make_shared<B>(a, value);}));
+		uut->RegisterTransient(std::function([](Container::Injection<IC, "missing"> c) {
+			return std::make_shared<D>(std::make_shared<B>(std::make_shared<A>(3), 4), c, 8);
+		}));
+		BOOST_CHECK_THROW(uut->Freeze(), ContainerException);
+		BOOST_TEST(!uut->IsFrozen());
+		uut->RegisterSingleton(std::make_shared<A>(3u));
+		uut->RegisterTransient(std::function([](unsigned val){return std::make_shared<CImpl>(val);}));
+		uut->RegisterOnInterface<IC, CImpl, "missing">(5u);
+		uut->Freeze();
+		BOOST_TEST(uut->Resolve<D>()->sum == 20u);
+	}
+
+	BOOST_AUTO_TEST_CASE(MissingLinkTarget)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val){return std::make_shared<CImpl>(val);}));
+		uut->RegisterOnInterface<IC, CImpl>();
+		BOOST_CHECK_THROW(uut->Freeze(), ContainerException);
+	}
+
+	BOOST_AUTO_TEST_CASE(RegisterFrozen)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::make_shared<A>(3u));
+		uut->Freeze();
+		BOOST_CHECK_THROW(uut->RegisterTransient(std::function([](unsigned val){return std::make_shared<CImpl>(val);})), ContainerException);
+		BOOST_CHECK_THROW((uut->RegisterOnInterface<IC, CImpl>(5u)), ContainerException);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
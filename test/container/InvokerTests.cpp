@@ -0,0 +1,69 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace {
+	/// Counts how many instances are alive
+	struct Counted{
+		static inline int alive = 0;
+		Counted() { ++alive; }
+		Counted(const Counted &) { ++alive; }
+		Counted(Counted &&) noexcept { ++alive; }
+		~Counted() { --alive; }
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(Invokers)
+
+	BOOST_AUTO_TEST_CASE(Inline)
+	{
+		{
+			Invoker<unsigned(unsigned)> invoker([counted = Counted(), offset = 2u](unsigned value){ return value + offset; });
+			BOOST_TEST(invoker(3u) == 5u);
+			auto moved = std::move(invoker);
+			BOOST_TEST(!invoker);
+			BOOST_TEST(moved(1u) == 3u);
+			BOOST_TEST(Counted::alive == 1);
+		}
+		BOOST_TEST(Counted::alive == 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(Heap)
+	{
+		{
+			std::array<unsigned, 64> values{};
+			values[63] = 7u;
+			Invoker<unsigned(std::size_t)> invoker([counted = Counted(), values](std::size_t index){ return values[index]; });
+			auto moved = std::move(invoker);
+			BOOST_TEST(moved(63u) == 7u);
+			BOOST_TEST(Counted::alive == 1);
+		}
+		BOOST_TEST(Counted::alive == 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(MoveOnlyMutable)
+	{
+		Invoker<std::unique_ptr<A>()> invoker([a = std::make_unique<A>(3u)]() mutable { return std::move(a); });
+		BOOST_TEST(invoker()->a == 3u);
+		BOOST_TEST(!invoker());
+	}
+
+	BOOST_AUTO_TEST_CASE(RegisterCallables)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton([](){ return std::make_shared<A>(3u); });
+		uut->RegisterTransient([calls = 0u](Container::Dependency<A> a, unsigned b) mutable { return std::make_shared<B>(a, b + ++calls); });
+		BOOST_TEST(uut->Resolve<B>(1u)->b == 2u);
+		BOOST_TEST(uut->Resolve<B>(1u)->b == 3u);
+		BOOST_TEST(uut->Resolve<B>(1u)->a == uut->Resolve<A>());
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include <memory_resource>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace {
+	/// Counts the allocations it forwards to the new-delete resource
+	struct CountingResource : std::pmr::memory_resource{
+		std::size_t allocations = 0;
+	private:
+		void *do_allocate(std::size_t bytes, std::size_t alignment) override{
+			++allocations;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+		void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override{
+			std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+		}
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override{
+			return this == &other;
+		}
+	};
+
+	/// pmr-aware type
+	struct Named{
+		using allocator_type = std::pmr::polymorphic_allocator<char>;
+		explicit Named(const char *name_, const allocator_type &allocator = {}) : name(name_, allocator) {}
+		std::pmr::string name;
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(MemoryResources)
+
+	BOOST_AUTO_TEST_CASE(Default)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](Container::Allocator allocator){
+			BOOST_TEST(allocator.value.resource() == std::pmr::get_default_resource());
+			return allocator.MakeShared<A>(3u);
+		}));
+		BOOST_TEST(uut->Resolve<A>()->a == 3u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Global)
+	{
+		CountingResource resource;
+		auto uut = std::make_shared<Container>();
+		uut->SetMemoryResource(&resource);
+		uut->RegisterTransient(std::function([](Container::Allocator allocator, unsigned a){return allocator.MakeShared<A>(a);}));
+		BOOST_TEST(uut->Resolve<A>(3u)->a == 3u);
+		BOOST_TEST(resource.allocations == 1u);
+		uut->SetMemoryResource(nullptr);
+		uut->Resolve<A>(3u);
+		BOOST_TEST(resource.allocations == 1u);
+	}
+
+	BOOST_AUTO_TEST_CASE(PerType)
+	{
+		CountingResource global, perType;
+		auto uut = std::make_shared<Container>();
+		uut->SetMemoryResource(&global);
+		uut->RegisterTransient(std::function([](Container::Allocator allocator){return allocator.MakeShared<A>(3u);}));
+		uut->RegisterScoped(std::function([](Container::Allocator allocator, unsigned b){return allocator.MakeShared<B>(allocator.MakeShared<A>(1u), b);}));
+		uut->SetMemoryResource<A>(&perType);
+		uut->Freeze();
+
+		uut->Resolve<A>();
+		BOOST_TEST(perType.allocations == 1u);
+		//the type's resource takes precedence over the scope's arena
+		Container::ResolutionScope scope(uut);
+		scope.Resolve<A>();
+		BOOST_TEST(perType.allocations == 2u);
+		scope.Resolve<B>(2u);
+		BOOST_TEST(perType.allocations == 2u);
+		BOOST_TEST(global.allocations == 0u);
+		BOOST_CHECK_THROW(uut->SetMemoryResource<D>(&perType), ContainerException);
+	}
+
+	BOOST_AUTO_TEST_CASE(ScopeUpstream)
+	{
+		CountingResource upstream;
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](Container::Allocator allocator){return allocator.MakeShared<Named>("a name that is too long for the small string buffer");}));
+		Container::ResolutionScope scope(uut, &upstream);
+		//fill the inline buffer of the arena
+		BOOST_TEST(scope.Resource().allocate(1024));
+		auto inst = scope.Resolve<Named>();
+		BOOST_TEST(inst->name == "a name that is too long for the small string buffer");
+		BOOST_TEST(inst->name.get_allocator().resource() == &scope.Resource());
+		BOOST_TEST(upstream.allocations > 0u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Batch)
+	{
+		CountingResource global, upstream;
+		auto uut = std::make_shared<Container>();
+		uut->SetMemoryResource(&global);
+		uut->RegisterTransient(std::function([](Container::Allocator allocator, unsigned b){return allocator.MakeShared<B>(nullptr, b);}));
+		auto previous = std::pmr::set_default_resource(&upstream);
+		auto batch = uut->ResolveN<B>(64u, 2u);
+		std::pmr::set_default_resource(previous);
+		BOOST_TEST(batch.size() == 64u);
+		BOOST_TEST(batch.back()->b == 2u);
+		//a single block for all instances
+		BOOST_TEST(upstream.allocations == 1u);
+		BOOST_TEST(global.allocations == 0u);
+		//outside of the batch the container's resource is used again
+		uut->Resolve<B>(2u);
+		BOOST_TEST(global.allocations == 1u);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
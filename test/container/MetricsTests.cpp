@@ -0,0 +1,90 @@
+//
+// Created by max on 10/18/26.
+//
+
+#define BOOST_TEST_MODULE metrics
+#include <boost/test/unit_test.hpp>
+#include <mabiphmo/ioc-container/Container.h>
+#include <numeric>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace {
+	template <class T>
+	Container::TypeMetrics MetricsOf(const Container &container){
+		auto snapshot = container.GetMetrics();
+		auto name = boost::typeindex::type_id<T>().pretty_name();
+		for (auto &type : snapshot.types)
+			if (type.name == name)
+				return type;
+		BOOST_FAIL("no metrics for " + name);
+		return {};
+	}
+
+	std::uint64_t HistogramCount(const Container::TypeMetrics &metrics){
+		return std::accumulate(metrics.factoryTime.begin(), metrics.factoryTime.end(), std::uint64_t(0));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(Metrics)
+
+	BOOST_AUTO_TEST_CASE(Singleton)
+	{
+		auto uut = std::make_shared<Container>();
+		BOOST_TEST(uut->GetMetrics().enabled);
+		uut->RegisterSingleton([](){ return std::make_shared<A>(3u); });
+		for (auto i = 0; i < 3; ++i)
+			uut->Resolve<A>();
+		auto metrics = MetricsOf<A>(*uut);
+		BOOST_TEST(metrics.resolves == 3u);
+		BOOST_TEST(metrics.factoryCalls == 1u);
+		BOOST_TEST(metrics.instanceHits == 2u);
+		BOOST_TEST(HistogramCount(metrics) == 1u);
+		BOOST_TEST(metrics.maxDepth == 1u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Dependencies)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient([](){ return std::make_shared<A>(3u); });
+		uut->RegisterTransient([](Container::Dependency<A> a, unsigned b){ return std::make_shared<B>(a, b); });
+		uut->RegisterSingleton([](){ return std::make_shared<CImpl>(5u); });
+		uut->RegisterOnInterface<IC, CImpl>();
+		uut->RegisterTransient([](Container::Injection<IC> c){ return std::make_shared<D>(std::make_shared<B>(std::make_shared<A>(1u), 2u), c, 8u); });
+		uut->Resolve<B>(1u);
+		uut->Resolve<B>(2u);
+		uut->Resolve<D>();
+		uut->GetResolver<A>()();
+
+		auto a = MetricsOf<A>(*uut);
+		BOOST_TEST(a.resolves == 3u);
+		BOOST_TEST(a.factoryCalls == 3u);
+		BOOST_TEST(a.instanceHits == 0u);
+		BOOST_TEST(a.maxDepth == 2u);
+		auto b = MetricsOf<B>(*uut);
+		BOOST_TEST(b.resolves == 2u);
+		BOOST_TEST(b.maxDepth == 1u);
+		auto c = MetricsOf<IC>(*uut);
+		BOOST_TEST(c.resolves == 1u);
+		BOOST_TEST(c.factoryCalls == 0u);
+		BOOST_TEST(MetricsOf<CImpl>(*uut).maxDepth == 3u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Histogram)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient([](){
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			return std::make_shared<A>(3u);
+		});
+		uut->Resolve<A>();
+		auto metrics = MetricsOf<A>(*uut);
+		//2ms are at least 2^20ns
+		auto slow = std::accumulate(metrics.factoryTime.begin() + 21, metrics.factoryTime.end(), std::uint64_t(0));
+		BOOST_TEST(slow == 1u);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,47 @@
+//
+// Created by max on 10/18/26.
+//
+
+#define BOOST_TEST_MODULE noRtti
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace{
+	struct Padding{
+		virtual ~Padding() = default;
+		unsigned padding = 0;
+	};
+
+	/// IC is not the first base, so the upcast has to adjust the pointer
+	struct Derived : Padding, CImpl{
+		explicit Derived(unsigned c_) : Padding(), CImpl(c_) {}
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(NoRtti)
+
+	BOOST_AUTO_TEST_CASE(Interface)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::function([](unsigned val){return std::make_shared<Derived>(val);}));
+		uut->RegisterOnInterface<IC, Derived>(5u);
+		auto c = uut->Resolve<IC>();
+		BOOST_TEST(c->C() == 5u);
+		BOOST_TEST(c.get() == static_cast<IC *>(uut->Resolve<Derived>().get()));
+		BOOST_TEST(Container::MultipleInjection<IC>(uut).size() == 1u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Failure)
+	{
+		auto uut = std::make_shared<Container>();
+		auto missing = uut->TryResolve<A>();
+		BOOST_TEST(missing.Error().Message().find("A") != std::string::npos);
+		BOOST_CHECK_THROW(uut->Resolve<A>(), ContainerException);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(Resolver)
+
+	BOOST_AUTO_TEST_CASE(Singleton)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::function([](){ return std::make_shared<A>(3u); }));
+		auto resolver = uut->GetResolver<A>();
+		auto inst = resolver();
+		BOOST_TEST(inst->a == 3u);
+		BOOST_TEST(inst == uut->Resolve<A>());
+		BOOST_TEST(inst == resolver());
+	}
+
+	BOOST_AUTO_TEST_CASE(SingletonInstance)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::make_shared<A>(3u));
+		BOOST_TEST(uut->GetResolver<A>()() == uut->Resolve<A>());
+	}
+
+	BOOST_AUTO_TEST_CASE(Transient)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val){ return std::make_shared<A>(val); }));
+		auto resolver = uut->GetResolver<A, unsigned>();
+		auto arg = 2u;
+		BOOST_TEST(resolver(arg)->a == 2u);
+		BOOST_TEST(resolver(3u)->a == 3u);
+
+		//replacing the factory does not invalidate the resolver
+		uut->RegisterTransient(std::function([](unsigned val){ return std::make_shared<A>(val * 2); }));
+		BOOST_TEST(resolver(3u)->a == 6u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Interface)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val){ return std::make_shared<CImpl>(val); }));
+		uut->RegisterOnInterface<IC, CImpl, "", unsigned>();
+		auto resolver = uut->GetResolver<IC, unsigned>();
+		BOOST_TEST(resolver(5u)->C() == 5u);
+	}
+
+	BOOST_AUTO_TEST_CASE(NotResolvable)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned val){ return std::make_shared<A>(val); }));
+		BOOST_CHECK_THROW(uut->GetResolver<A>(), ContainerException);
+		BOOST_CHECK_THROW(uut->GetResolver<B>(), ContainerException);
+	}
+
+	BOOST_AUTO_TEST_CASE(Many)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::make_shared<A>(3u));
+		uut->RegisterTransient(std::function([](Container::Dependency<A> a){ return std::make_shared<B>(a, 4u); }));
+		auto [a, b, container] = uut->ResolveMany<A, B, Container>();
+		BOOST_TEST(a->a == 3u);
+		BOOST_TEST(b->a == a);
+		BOOST_TEST(container == uut);
+		BOOST_CHECK_THROW((uut->ResolveMany<A, D>()), ContainerException);
+	}
+
+	BOOST_AUTO_TEST_CASE(N)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::make_shared<A>(3u));
+		uut->RegisterTransient(std::function([](Container::Dependency<A> a, std::string name){ return std::make_shared<B>(a, static_cast<unsigned>(name.size())); }));
+		auto name = std::string("four");
+		auto transients = uut->ResolveN<B>(3u, std::move(name));
+		BOOST_TEST(transients.size() == 3u);
+		BOOST_TEST(transients[0] != transients[1]);
+		//the argument is passed to every call, so it must not have been moved from
+		BOOST_TEST(transients[2]->b == 4u);
+		auto singletons = uut->ResolveN<A>(2u);
+		BOOST_TEST(singletons[0] == singletons[1]);
+		BOOST_TEST(uut->ResolveN<B>(0u, std::string()).empty());
+		BOOST_CHECK_THROW(uut->ResolveN<D>(1u), ContainerException);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -69,5 +69,44 @@ BOOST_AUTO_TEST_SUITE(Scopes)
 		BOOST_TEST((value = 3u, inst->C() == 3u));
 	}
 
+	BOOST_AUTO_TEST_CASE(Scoped)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterScoped(std::function([](){return std::make_shared<A>(3);}));
+		std::weak_ptr<A> expired;
+		{
+			Container::ResolutionScope scope(uut);
+			auto inst = scope.Resolve<A>();
+			BOOST_TEST(inst == scope.Resolve<A>());
+			Container::ResolutionScope other(uut);
+			BOOST_TEST(inst != other.Resolve<A>());
+			expired = inst;
+		}
+		BOOST_TEST(expired.expired());
+		BOOST_CHECK_THROW(uut->Resolve<A>(), ContainerException);
+	}
+
+	BOOST_AUTO_TEST_CASE(ScopedDependency)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterScoped(std::function([](){return std::make_shared<A>(3);}));
+		uut->RegisterTransient(std::function([](Container::Dependency<A> a, unsigned b){return std::make_shared<B>(a, b);}));
+		Container::ResolutionScope scope(uut);
+		BOOST_TEST(scope.Resolve<B>(1u)->a == scope.Resolve<B>(2u)->a);
+		BOOST_TEST(scope.Resolve<B>(1u)->a == scope.Resolve<A>());
+	}
+
+	BOOST_AUTO_TEST_CASE(ScopedAllocator)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterScoped(std::function([](Container::Allocator allocator){return allocator.MakeShared<A>(3u);}));
+		Container::ResolutionScope scope(uut);
+		auto inst = scope.Resolve<A>();
+		auto begin = reinterpret_cast<std::uintptr_t>(&scope);
+		auto address = reinterpret_cast<std::uintptr_t>(inst.get());
+		BOOST_TEST(inst->a == 3u);
+		BOOST_TEST((address >= begin && address < begin + sizeof(scope)));
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,97 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/StaticContainer.h>
+#include <boost/test/unit_test.hpp>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace{
+	struct CountedA : A{
+		static inline unsigned constructed = 0;
+		explicit CountedA(unsigned a_) : A(a_) {++constructed;}
+	};
+
+	unsigned refValue = 7u;
+
+	using Bindings = StaticContainer<
+		StaticSingleton<A, []{ return std::make_shared<A>(3u); }>,
+		StaticTransient<B, [](Container::Dependency<A> a, unsigned value){ return std::make_shared<B>(a, value); }>,
+		StaticSingleton<CImpl, []{ return std::make_shared<CImpl>(5u); }>,
+		StaticTransient<CImpl2, []{ return std::make_shared<CImpl2>(refValue); }>,
+		StaticLink<IC, CImpl>,
+		StaticLink<IC, CImpl2, "ref">,
+		StaticTransient<D, [](Container::Dependency<A> a, Container::Injection<IC> c, Container::MultipleInjection<IC> all, unsigned value){
+			BOOST_TEST(all.value.size() == 2u);
+			return std::make_shared<D>(std::make_shared<B>(a, 1u), c, value);
+		}>,
+		DynamicBinding<CountedA>>;
+}
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(StaticContainerTests)
+
+	BOOST_AUTO_TEST_CASE(Binds)
+	{
+		static_assert(Bindings::Binds<A>);
+		static_assert(Bindings::Binds<IC>);
+		static_assert(Bindings::Binds<CountedA>);
+		static_assert(!Bindings::Binds<CImpl2 *>);
+	}
+
+	BOOST_AUTO_TEST_CASE(Singleton)
+	{
+		Bindings uut;
+		auto a = uut.Resolve<A>();
+		BOOST_TEST(a->a == 3u);
+		BOOST_TEST(uut.Resolve<A>() == a);
+	}
+
+	BOOST_AUTO_TEST_CASE(Transient)
+	{
+		Bindings uut;
+		auto b = uut.Resolve<B>(4u);
+		BOOST_TEST(b->b == 4u);
+		BOOST_TEST(b->a == uut.Resolve<A>());
+		BOOST_TEST(uut.Resolve<B>(4u) != b);
+	}
+
+	BOOST_AUTO_TEST_CASE(Interface)
+	{
+		Bindings uut;
+		BOOST_TEST(uut.Resolve<IC>()->C() == 5u);
+		BOOST_TEST(uut.Resolve<IC>() == uut.Resolve<CImpl>());
+		auto ref = uut.ResolveInterface<IC, "ref">();
+		refValue = 8u;
+		BOOST_TEST(ref->C() == 8u);
+		auto all = uut.ResolveAll<IC>();
+		BOOST_TEST(all.size() == 2u);
+		BOOST_TEST(all[0] == uut.Resolve<IC>());
+	}
+
+	BOOST_AUTO_TEST_CASE(Dependencies)
+	{
+		Bindings uut;
+		auto d = uut.Resolve<D>(2u);
+		BOOST_TEST(d->b->a == uut.Resolve<A>());
+		BOOST_TEST(d->c == uut.Resolve<IC>());
+		BOOST_TEST(d->sum == 1u + 3u + 5u + 2u);
+	}
+
+	BOOST_AUTO_TEST_CASE(Dynamic)
+	{
+		auto fallback = std::make_shared<Container>();
+		fallback->RegisterSingleton(std::function([](){ return std::make_shared<CountedA>(9u); }));
+		Bindings uut(fallback);
+		BOOST_TEST(uut.Resolve<CountedA>()->a == 9u);
+		BOOST_TEST(uut.Resolve<CountedA>() == fallback->Resolve<CountedA>());
+		BOOST_TEST(CountedA::constructed == 1u);
+
+		Bindings withoutFallback;
+		BOOST_CHECK_THROW(withoutFallback.Resolve<CountedA>(), ContainerException);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
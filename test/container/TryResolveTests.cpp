@@ -0,0 +1,63 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(TryResolve)
+
+	BOOST_AUTO_TEST_CASE(Resolved)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::make_shared<A>(3u));
+		uut->RegisterTransient(std::function([](Container::Dependency<A> a, unsigned value){return std::make_shared<B>(a, value);}));
+		auto a = uut->TryResolve<A>();
+		BOOST_TEST(a.HasValue());
+		BOOST_TEST(a->a == 3u);
+		auto b = uut->TryResolve<B>(5u);
+		BOOST_TEST(static_cast<bool>(b));
+		BOOST_TEST(b.Value()->a == a.Get());
+	}
+
+	BOOST_AUTO_TEST_CASE(Failed)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](unsigned value){return std::make_shared<A>(value);}));
+		auto missing = uut->TryResolve<B>();
+		BOOST_TEST(!missing.HasValue());
+		BOOST_TEST(!missing.Get());
+		BOOST_TEST((missing.Error().Code() == Container::ResolveError::NotRegistered));
+		BOOST_TEST(missing.Error().Message().find("is not registered") != std::string::npos);
+		BOOST_CHECK_THROW(static_cast<void>(missing.Value()), ContainerException);
+
+		auto arguments = uut->TryResolve<A>();
+		BOOST_TEST((arguments.Error().Code() == Container::ResolveError::NoFactory));
+		BOOST_TEST(arguments.Error().Message().find("with the supplied arguments") != std::string::npos);
+	}
+
+	BOOST_AUTO_TEST_CASE(Interface)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton(std::function([](unsigned val){return std::make_shared<CImpl>(val);}));
+		uut->RegisterOnInterface<IC, CImpl, "5">(5u);
+		BOOST_TEST((uut->TryResolveInterface<IC, "5">()->C() == 5u));
+		BOOST_TEST(uut->TryResolveInterfaceRuntimeId<IC>("5")->C() == 5u);
+		BOOST_TEST((uut->TryResolveInterface<IC>().Error().Code() == Container::ResolveError::NoLink));
+		BOOST_TEST(uut->TryResolveAll<IC>()->size() == 1u);
+		BOOST_TEST((uut->TryResolveAll<CImpl>().Error().Code() == Container::ResolveError::NotAnInterface));
+	}
+
+	BOOST_AUTO_TEST_CASE(FactoryThrows)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterTransient(std::function([](Container::Dependency<A> a, unsigned value){return std::make_shared<B>(a, value);}));
+		BOOST_CHECK_THROW(uut->TryResolve<B>(5u), ContainerException);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,110 @@
+//
+// Created by max on 10/18/26.
+//
+
+#include <mabiphmo/ioc-container/Container.h>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <thread>
+#include "structs.h"
+
+using namespace mabiphmo::ioc_container;
+
+namespace {
+	struct X;
+	struct Y;
+	struct X{ explicit X(std::shared_ptr<Y> y_) : y(std::move(y_)) {} std::shared_ptr<Y> y; };
+	struct Y{ explicit Y(std::shared_ptr<X> x_) : x(std::move(x_)) {} std::shared_ptr<X> x; };
+
+	/// Records the order types are constructed in
+	struct Order{
+		std::mutex mutex;
+		std::vector<std::string> names;
+		void Add(std::string name){
+			std::lock_guard lock(mutex);
+			names.push_back(std::move(name));
+		}
+		std::size_t IndexOf(const std::string &name){
+			return static_cast<std::size_t>(std::find(names.begin(), names.end(), name) - names.begin());
+		}
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(container)
+BOOST_AUTO_TEST_SUITE(WarmUp)
+
+	BOOST_AUTO_TEST_CASE(DependencyOrder)
+	{
+		auto uut = std::make_shared<Container>();
+		Order order;
+		uut->RegisterSingleton([&](){ order.Add("A"); return std::make_shared<A>(3u); });
+		uut->RegisterSingleton([&](Container::Dependency<A> a){ order.Add("B"); return std::make_shared<B>(a, 4u); });
+		uut->RegisterSingleton([&](){ order.Add("CImpl"); return std::make_shared<CImpl>(5u); });
+		uut->RegisterOnInterface<IC, CImpl>();
+		uut->RegisterSingleton([&](Container::Dependency<B> b, Container::Injection<IC> c){ order.Add("D"); return std::make_shared<D>(b, c, 8u); });
+		//singletons with arguments cannot be warmed up
+		uut->RegisterSingleton([](unsigned value){ return std::make_shared<CImpl2>(value); });
+
+		auto report = uut->WarmUp(4);
+		BOOST_TEST(report.Succeeded());
+		BOOST_TEST(report.entries.size() == 4u);
+		BOOST_TEST(order.names.size() == 4u);
+		BOOST_TEST(order.IndexOf("A") < order.IndexOf("B"));
+		BOOST_TEST(order.IndexOf("B") < order.IndexOf("D"));
+		BOOST_TEST(order.IndexOf("CImpl") < order.IndexOf("D"));
+		BOOST_TEST(uut->Resolve<D>()->sum == 20u);
+		BOOST_TEST(order.names.size() == 4u);
+		BOOST_TEST(uut->WarmUp(4).entries.empty());
+	}
+
+	BOOST_AUTO_TEST_CASE(Concurrent)
+	{
+		auto uut = std::make_shared<Container>();
+		auto started = std::atomic<unsigned>(0);
+		auto overlapped = std::atomic<unsigned>(0);
+		auto factory = [&](){
+			++started;
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+			while (started.load() < 2u && std::chrono::steady_clock::now() < deadline)
+				std::this_thread::yield();
+			if (started.load() == 2u)
+				++overlapped;
+		};
+		uut->RegisterSingleton([&](){ factory(); return std::make_shared<A>(3u); });
+		uut->RegisterSingleton([&](){ factory(); return std::make_shared<CImpl>(5u); });
+		auto report = uut->WarmUp(2);
+		BOOST_TEST(report.Succeeded());
+		BOOST_TEST(overlapped == 2u);
+		BOOST_TEST(report.total >= report.entries.front().duration);
+	}
+
+	BOOST_AUTO_TEST_CASE(Executor)
+	{
+		auto uut = std::make_shared<Container>();
+		auto tasks = 0u;
+		uut->RegisterSingleton([](){ return std::make_shared<A>(3u); });
+		uut->RegisterSingleton([](Container::Dependency<A> a){ return std::make_shared<B>(a, 4u); });
+		auto report = uut->WarmUp([&](const std::function<void()> &task){ ++tasks; task(); });
+		BOOST_TEST(report.Succeeded());
+		BOOST_TEST(tasks == 2u);
+		BOOST_TEST(report.entries.front().name == boost::typeindex::type_id<A>().pretty_name());
+	}
+
+	BOOST_AUTO_TEST_CASE(Errors)
+	{
+		auto uut = std::make_shared<Container>();
+		uut->RegisterSingleton([]() -> std::shared_ptr<A> { throw std::runtime_error("failed"); });
+		uut->RegisterSingleton([](Container::Dependency<A> a){ return std::make_shared<B>(a, 4u); });
+		uut->RegisterSingleton([](Container::Dependency<Y> y){ return std::make_shared<X>(y); });
+		uut->RegisterSingleton([](Container::Dependency<X> x){ return std::make_shared<Y>(x); });
+		uut->RegisterSingleton([](){ return std::make_shared<CImpl>(5u); });
+		auto report = uut->WarmUp(2);
+		BOOST_TEST(!report.Succeeded());
+		BOOST_TEST(report.entries.size() == 5u);
+		auto failed = std::count_if(report.entries.begin(), report.entries.end(), [](const auto &entry){ return static_cast<bool>(entry.error); });
+		BOOST_TEST(failed == 4);
+		BOOST_TEST(uut->Resolve<CImpl>()->C() == 5u);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 #define IOC_ARGSTRUCTS_H
 
 #include <utility>
+#include <string>
 
 struct lvalueRefArgs{
 	lvalueRefArgs(unsigned &a_) : a(a_) {}
@@ -29,4 +30,9 @@ struct rvalueRefArgs{
 	unsigned a;
 };
 
+struct stringArgs{
+	stringArgs(std::string a_) : a(std::move(a_)) {}
+	std::string a;
+};
+
 #endif //IOC_ARGSTRUCTS_H